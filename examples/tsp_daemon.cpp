@@ -0,0 +1,65 @@
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <pthread.h>
+#include "Service/SolverDaemon.h"
+
+/**
+ * @brief 常駐求解服務 (Solver Daemon)
+ * * 用法：tsp_daemon [--unix <路徑>] [--port <連接埠>] [--workers <執行緒數>] [--cache <實例數>]
+ * 未指定位址時預設監聽 /tmp/tsp_solver.sock。收到 SIGINT / SIGTERM 時停止服務。
+ * 協定說明見 SolverDaemon.h；例如：
+ *   printf 'SOLVE time=2 seed=1\n0 0\n10 0\n10 10\n0 10\nEND\n' | nc -U /tmp/tsp_solver.sock
+ */
+int main(int argc, char** argv) {
+    DaemonConfig config;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        if (flag == "--unix") {
+            config.unixPath = value;
+        } else if (flag == "--port") {
+            config.tcpPort = std::atoi(value.c_str());
+        } else if (flag == "--workers") {
+            config.workerCount = static_cast<unsigned int>(std::atoi(value.c_str()));
+        } else if (flag == "--cache") {
+            config.cacheCapacity = static_cast<std::size_t>(std::atoi(value.c_str()));
+        } else {
+            std::cerr << "Unknown option " << flag << std::endl;
+            return 1;
+        }
+    }
+    if (config.unixPath.empty() && config.tcpPort < 0) {
+        config.unixPath = "/tmp/tsp_solver.sock";
+    }
+
+    // 在建立任何執行緒之前封鎖結束訊號，讓所有執行緒繼承遮罩，由主執行緒以 sigwait 統一接收
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    try {
+        SolverDaemon daemon(config);
+        daemon.start();
+        std::cout << "[Daemon] Listening on";
+        if (!config.unixPath.empty()) std::cout << " unix:" << config.unixPath;
+        if (daemon.port() >= 0) std::cout << " tcp:127.0.0.1:" << daemon.port();
+        std::cout << std::endl;
+
+        int received = 0;
+        sigwait(&signals, &received);
+        std::cout << "[Daemon] Shutting down..." << std::endl;
+        daemon.stop();
+
+        SolverDaemon::Stats stats = daemon.stats();
+        std::cout << "[Daemon] Served " << stats.requests << " requests (cache hits: " << stats.cacheHits
+                  << ", misses: " << stats.cacheMisses << ")" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "[Daemon] " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+#ifndef AUTO_TUNER_H
+#define AUTO_TUNER_H
+
+#include "Core/Types.h"
+#include <string>
+#include <vector>
+
+/**
+ * @struct TuningProfile
+ * @brief 自動校準的結果 (可依主機名稱保存並於下次啟動時重用)
+ */
+struct TuningProfile {
+    int cityCount = 0;               /**< 校準時的城市規模 (套用到其他規模時依比例換算族群大小) */
+    unsigned int threadCount = 0;    /**< 評估吞吐量最高的平行批次任務數 */
+    int parallelThreshold = 64;      /**< 平行評估開始勝過序列評估的族群大小 */
+    int populationSize = 0;          /**< 短時間演化中進步最快的族群規模 */
+    int localSearchCount = 1;        /**< 每代執行 2-Opt 的個體數 (Memetic 強度) */
+};
+
+/**
+ * @class AutoTuner
+ * @brief 啟動時自動校準器 (Startup Auto-Tuner)
+ * * GAConfig::generateDefault 的 P ≈ 4n 與評估器固定的平行門檻皆未考慮實際硬體與實例。
+ * 本類別在載入的實例上執行數個短時間的校準測試：
+ * 1. 評估吞吐量：依序嘗試 1, 2, 4, ... 個批次任務，選出每秒評估數最高者；
+ * 2. 平行門檻：比較不同族群大小下序列與平行評估的耗時，找出平行化開始划算的規模；
+ * 3. 演化測試：在相同時間片內以不同族群規模與 Memetic 強度執行 GA，選出最終距離最短者
+ *    (等時間比較即「每秒改進量」最大者)。
+ * * 所有成員均為靜態 (static)。校準結果為選用功能，不影響未呼叫本類別的既有流程。
+ */
+class AutoTuner {
+public:
+    /**
+     * @brief 在指定實例上執行校準
+     * @param cities 城市座標列表
+     * @param base 基礎設定 (其餘參數如突變率、初始化比例會沿用於演化測試)
+     * @param budgetSeconds 校準總時間預算 (秒)，約 1/5 用於評估測試，其餘用於演化測試
+     * @return 校準結果
+     */
+    static TuningProfile calibrate(const std::vector<City>& cities,
+                                   const GAConfig& base,
+                                   double budgetSeconds = 3.0);
+
+    /**
+     * @brief 將校準結果套用到設定上
+     * * 族群大小依 config.cityCount / profile.cityCount 比例換算，精英數同步調整為約 3%。
+     * @param profile 校準結果
+     * @param config [in/out] 欲調整的設定
+     */
+    static void apply(const TuningProfile& profile, GAConfig& config);
+
+    /**
+     * @brief 目前主機的預設設定檔路徑
+     * @return $HOME/.cache/ga_tsp_tuning/<hostname>.profile (無 HOME 時改用暫存目錄)
+     */
+    static std::string defaultProfilePath();
+
+    /**
+     * @brief 保存校準結果
+     * * 設定檔以「規模級距」(城市數的 log2) 為鍵，每個級距一行；同級距的舊紀錄會被覆寫。
+     * @param profile 校準結果
+     * @param path 設定檔路徑 (上層目錄不存在時自動建立)
+     * @return 是否寫入成功
+     */
+    static bool saveProfile(const TuningProfile& profile, const std::string& path);
+
+    /**
+     * @brief 讀取與指定城市規模同級距的校準結果
+     * @param path 設定檔路徑
+     * @param cityCount 城市數量
+     * @param profile [out] 讀取到的校準結果
+     * @return 是否找到對應級距的紀錄
+     */
+    static bool loadProfile(const std::string& path, int cityCount, TuningProfile& profile);
+
+    /**
+     * @brief 取得經校準的設定：優先讀取主機設定檔，沒有紀錄時才執行校準並保存
+     * @param cities 城市座標列表
+     * @param budgetSeconds 需要校準時的時間預算 (秒)
+     * @param path 設定檔路徑
+     * @return 以 GAConfig::generateDefault 為基礎並套用校準結果的設定
+     */
+    static GAConfig tunedConfig(const std::vector<City>& cities,
+                                double budgetSeconds = 3.0,
+                                const std::string& path = defaultProfilePath());
+
+private:
+    /**
+     * @brief 城市規模級距 (floor(log2 n))
+     */
+    static int sizeClass(int cityCount);
+};
+
+#endif
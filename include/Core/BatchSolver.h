@@ -0,0 +1,96 @@
+#ifndef BATCH_SOLVER_H
+#define BATCH_SOLVER_H
+
+#include "Core/Types.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class BatchSolver
+ * @brief 批次吞吐量求解器 (Batch Throughput Mode)
+ * * 針對「大量小型實例」的使用情境 (例如上千條 20–80 個城市的路線) 設計。
+ * 單一小實例的族群規模通常低於 ParallelEvaluator 的平行門檻，無法利用多核心；
+ * 本類別改以「整個求解任務」為排程單位，在共享的常駐工作執行緒池上
+ * 每個核心同時執行一個 GASolver，且強制關閉內部平行評估以避免巢狀平行化。
+ */
+class BatchSolver {
+public:
+    /** @brief 依城市數量產生 GA 參數的工廠函式 (預設為 GAConfig::generateDefault) */
+    using ConfigFactory = std::function<GAConfig(int)>;
+
+    /**
+     * @brief 單一實例完成時的回呼函式
+     * 格式：void(實例索引, 該實例的最佳個體)。回呼會在工作執行緒上被序列化呼叫，
+     * 呼叫期間不持有任何內部狀態鎖；回呼拋出的例外視同該實例求解失敗。
+     */
+    using ResultCallback = std::function<void(std::size_t, const Individual&)>;
+
+    /**
+     * @brief 建構子：啟動常駐工作執行緒池
+     * @param workerCount 工作執行緒數量，0 代表使用 std::thread::hardware_concurrency()
+     */
+    explicit BatchSolver(unsigned int workerCount = 0);
+
+    /**
+     * @brief 解構子：通知所有工作執行緒結束並回收
+     */
+    ~BatchSolver();
+
+    BatchSolver(const BatchSolver&) = delete;
+    BatchSolver& operator=(const BatchSolver&) = delete;
+
+    /**
+     * @brief 批次求解多個獨立的 TSP 實例
+     * * 每個實例都會被封裝為一個完整的求解任務並投入執行緒池，
+     * 任一實例完成時立即透過 onResult 回報，無需等待整批結束。
+     * @param instances 各實例的城市座標列表
+     * @param makeConfig 參數工廠，依各實例的城市數量產生設定 (useParallel 會被強制關閉)
+     * @param onResult 完成回呼 (可為空)
+     * @return 依輸入順序排列的各實例最佳個體
+     * @throw 若任一求解任務拋出例外，會在整批結束後重新拋出第一個例外
+     * @throw std::runtime_error 自本執行緒池的工作執行緒 (例如 submit 的任務內) 呼叫時；
+     * 該執行緒會阻塞等待子任務而佔住池內名額，必然導致死結。需要巢狀批次時請另建一個 BatchSolver
+     */
+    std::vector<Individual> solveAll(const std::vector<std::vector<City>>& instances,
+                                     const ConfigFactory& makeConfig = &GAConfig::generateDefault,
+                                     const ResultCallback& onResult = nullptr);
+
+    /**
+     * @brief 投遞一個任意任務至共享執行緒池
+     * * 供需要「一個核心一個求解」排程的上層模組 (如分解求解器) 共用同一組工作執行緒。
+     * @param job 欲執行的任務
+     */
+    void submit(std::function<void()> job);
+
+    /**
+     * @brief 取得工作執行緒數量
+     */
+    unsigned int workerCount() const { return static_cast<unsigned int>(m_workers.size()); }
+
+private:
+    /**
+     * @brief 工作執行緒主迴圈：從佇列取出任務並執行，直到收到停止訊號
+     */
+    void workerLoop();
+
+    /** @brief 常駐工作執行緒 */
+    std::vector<std::thread> m_workers;
+
+    /** @brief 待執行的任務佇列 */
+    std::deque<std::function<void()>> m_jobs;
+
+    /** @brief 保護任務佇列的互斥鎖 */
+    std::mutex m_mutex;
+
+    /** @brief 任務到達 / 停止通知 */
+    std::condition_variable m_cv;
+
+    /** @brief 是否正在關閉執行緒池 */
+    bool m_stopping = false;
+};
+
+#endif
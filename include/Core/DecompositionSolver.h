@@ -0,0 +1,104 @@
+#ifndef DECOMPOSITION_SOLVER_H
+#define DECOMPOSITION_SOLVER_H
+
+#include "Core/Types.h"
+#include <functional>
+#include <vector>
+
+/**
+ * @struct DecompositionConfig
+ * @brief 分解求解器的參數配置
+ */
+struct DecompositionConfig {
+    int clusterSize = 200;        /**< 每個子問題的目標城市數 (決定分群數 $k = \lceil n / clusterSize \rceil$) */
+    int kmeansIterations = 10;    /**< k-means (Lloyd) 迭代次數 */
+    int windowSize = 60;          /**< 邊界重新優化視窗的城市數 */
+    int refinementPasses = 3;     /**< 邊界視窗重新優化的回合數 */
+    unsigned int workerCount = 0; /**< 平行求解子問題的工作執行緒數，0 代表硬體執行緒數 */
+
+    /**
+     * @brief 子問題 GA 參數工廠 (格式：GAConfig(子問題城市數))
+     * 預設為 clusterDefault，會限制族群規模與代數以控制整體耗時。
+     */
+    std::function<GAConfig(int)> clusterConfig = &DecompositionConfig::clusterDefault;
+
+    /**
+     * @brief 子問題的預設 GA 參數
+     * * 以 GAConfig::generateDefault 為基礎，但將 $P$ 上限設為 400、$G$ 上限設為 1000，
+     * 讓數十個子問題的總耗時維持在分鐘級。
+     * @param n 子問題城市數
+     */
+    static GAConfig clusterDefault(int n) {
+        GAConfig config = GAConfig::generateDefault(n);
+        config.populationSize = std::min(config.populationSize, 400);
+        config.generations = std::min(20 * n, 1000);
+        return config;
+    }
+};
+
+/**
+ * @class DecompositionSolver
+ * @brief 大規模實例的分解求解器 (Partition → Solve → Stitch)
+ * * 當 $n$ 達到 $10^4$ 以上時，單一族群與 $n \times n$ 距離矩陣皆不可行。本類別：
+ * 1. 以 k-means 依空間位置將城市分群 (以 Hilbert 曲線順序切塊作為初始中心)；
+ * 2. 透過 BatchSolver 在共享執行緒池上平行求解每個子問題 (每個子問題各自建立小矩陣)；
+ * 3. 依群中心的巡迴順序，為每個子迴路選擇最佳的切斷邊與方向後串接成全域路徑；
+ * 4. 在子問題交界處的視窗內執行固定端點的 2-Opt，修補串接造成的劣質邊。
+ * * 全程僅以座標即時計算距離，記憶體用量為 $O(n)$。
+ */
+class DecompositionSolver {
+public:
+    /**
+     * @brief 建構子
+     * @param config 分解參數
+     * @param cities 全域城市座標列表
+     */
+    DecompositionSolver(const DecompositionConfig& config, const std::vector<City>& cities);
+
+    /**
+     * @brief 執行分解求解
+     * @return 全域路徑 (path 為 cities 的索引) 與其總距離
+     */
+    Individual solve();
+
+    /**
+     * @brief 取得最後一次求解的分群結果
+     * @return clusters[c] 為第 c 群的城市索引
+     */
+    const std::vector<std::vector<int>>& getClusters() const { return m_clusters; }
+
+private:
+    /** @brief 兩城市間的歐幾里得距離 (即時計算) */
+    double dist(int a, int b) const;
+
+    /** @brief 以 k-means 將城市依空間分群，並拆分過大的群 */
+    void partition();
+
+    /** @brief 依群中心求出子問題的拜訪順序 */
+    std::vector<int> orderClusters() const;
+
+    /**
+     * @brief 將各群的封閉子迴路串接為全域路徑
+     * @param subTours subTours[c] 為第 c 群的封閉迴路 (元素為全域城市索引)
+     * @param order 群的拜訪順序
+     * @param junctions [out] 各群在全域路徑中的起始位置 (交界處)
+     */
+    std::vector<int> stitch(const std::vector<std::vector<int>>& subTours,
+                            const std::vector<int>& order,
+                            std::vector<int>& junctions) const;
+
+    /**
+     * @brief 對全域路徑中以 start 起算、長度 windowSize 的視窗執行固定端點 2-Opt
+     * @return 該視窗減少的距離
+     */
+    double optimizeWindow(std::vector<int>& tour, int start) const;
+
+    /** @brief 計算封閉路徑總距離 */
+    double tourLength(const std::vector<int>& tour) const;
+
+    DecompositionConfig m_config;
+    std::vector<City> m_cities;
+    std::vector<std::vector<int>> m_clusters;
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef EXACT_SOLVER_H
+#define EXACT_SOLVER_H
+
+#include "Core/Types.h"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class ExactSolver
+ * @brief 小型實例的精確解 (Held-Karp Bitmask Dynamic Programming)
+ * * 固定城市 0 為起點，$dp[S][j]$ 為「從 0 出發、恰好拜訪集合 S 後停在 j」的最短路徑長，
+ * 轉移 $dp[S][j] = \min_{k \in S \setminus j} dp[S \setminus j][k] + d(k, j)$，
+ * 時間 $O(2^n n^2)$。對 n ≤ 20 左右的實例只需數毫秒至數秒，且保證最佳。
+ * * 平行化：同一個「集合大小層」(popcount 相同) 的狀態只依賴上一層，
+ * 因此逐層推進，層內依子集分段交給 std::async 平行計算。
+ * * 記憶體：dp 值全程以 double 計算，但只保留相鄰兩層 (以子集在層內的序號定址)，
+ * 另以每個狀態 1 位元組的回溯指標 (前一個城市) 還原路徑；n = 22 時合計約 170 MB，
+ * 而非完整 double 表的 350 MB，也不必為了容量退回 float 而犧牲最佳性。
+ * 所有成員均為靜態 (static)。
+ */
+class ExactSolver {
+public:
+    /** @brief 支援的最大城市數 */
+    static constexpr int kMaxCities = 22;
+
+    /**
+     * @brief 求解最佳迴路
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量 (1 ≤ n ≤ kMaxCities)
+     * @param useParallel 是否逐層平行計算
+     * @return 最佳個體 (路徑自城市 0 出發，distance 為最佳長度)
+     * @throw std::runtime_error 當 n 超出支援範圍
+     */
+    static Individual solve(const std::vector<double>& distMatrix, int n, bool useParallel = true);
+
+    /**
+     * @brief 估計 dp 表所需的記憶體
+     * @param n 城市數量
+     * @return 位元組數
+     */
+    static std::size_t memoryRequired(int n);
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef FITNESS_CACHE_H
+#define FITNESS_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class FitnessCache
+ * @brief 以路徑雜湊為鍵的並行適應度快取 (Concurrent Fitness Cache)
+ * * 族群中常出現大量重複路徑 (精英複本、收斂後的相同子代)，重新計算其距離只是浪費 $O(n)$ 查表。
+ * 本類別將「路徑雜湊 → 路徑距離」分散存放於多個分片 (Shard)，每個分片各自持有互斥鎖，
+ * 讓 ParallelEvaluator 的多個執行緒能同時查詢與寫入而不互相阻塞。
+ * * 快取採用容量上限：單一分片超出上限時整片清空，以固定的記憶體用量換取實作的簡潔。
+ */
+class FitnessCache {
+public:
+    /**
+     * @brief 建構子
+     * @param capacity 快取總容量上限 (筆數)
+     * @param shardCount 分片數量，越多則鎖競爭越低
+     */
+    explicit FitnessCache(std::size_t capacity = 1 << 20, std::size_t shardCount = 64);
+
+    /**
+     * @brief 查詢路徑距離
+     * @param hash 路徑雜湊值 (TourHash)
+     * @param distance [out] 命中時寫入快取的距離
+     * @return 是否命中
+     */
+    bool lookup(std::uint64_t hash, double& distance);
+
+    /**
+     * @brief 寫入路徑距離
+     * @param hash 路徑雜湊值
+     * @param distance 該路徑的總距離
+     */
+    void insert(std::uint64_t hash, double distance);
+
+    /**
+     * @brief 清空所有分片與統計數據
+     */
+    void clear();
+
+    /** @brief 累計命中次數 */
+    std::size_t hits() const { return m_hits.load(std::memory_order_relaxed); }
+
+    /** @brief 累計未命中次數 */
+    std::size_t misses() const { return m_misses.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * @struct Shard
+     * @brief 單一快取分片：一把鎖保護一張雜湊表
+     */
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<std::uint64_t, double> entries;
+    };
+
+    /** @brief 依雜湊值選擇分片 (使用高位元，避免與 unordered_map 的低位元分桶重疊) */
+    Shard& shardFor(std::uint64_t hash) { return *m_shards[(hash >> 40) % m_shards.size()]; }
+
+    /** @brief 所有分片 (std::mutex 不可移動，故以指標持有) */
+    std::vector<std::unique_ptr<Shard>> m_shards;
+
+    /** @brief 單一分片的容量上限 */
+    std::size_t m_shardCapacity;
+
+    std::atomic<std::size_t> m_hits{0};
+    std::atomic<std::size_t> m_misses{0};
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef FIXED_KERNELS_H
+#define FIXED_KERNELS_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class FixedKernels
+ * @brief 依城市規模分級的固定大小運算核心 (Size-Class Specialized Kernels)
+ * * 路徑評估與 OX 交叉是 GA 內層迴圈中呼叫最頻繁的兩個函式。通用版本以執行期的
+ * cityCount 搭配 `% n` 環狀索引，且每次交叉都要配置 `std::vector<bool>`。
+ * * OX 交叉為 n ≤ 64、≤ 256、≤ 1024 三個規模等級各實例化一份模板核心：
+ * - 暫存區改用堆疊上的 `std::array`，城市編號以 uint8 / uint16 儲存，整份暫存區可常駐 L1；
+ * - 已拜訪標記改用 `std::bitset`；
+ * - 環狀走訪拆成兩段線性迴圈，移除 `% n`，讓編譯器可以展開與向量化。
+ * 超過 1024 的實例使用 thread_local 暫存區的通用版本，同樣不在呼叫中配置記憶體。
+ * * 路徑評估沒有可依規模固定的暫存區，只依矩陣大小選擇 32 位元或 size_t 的列偏移。
+ * * 分派依據為執行期的 n，分支在整次求解中結果固定，預測成本可忽略。
+ * 所有成員均為靜態 (static)，且各核心的結果與通用實作逐位元相同。
+ */
+class FixedKernels {
+public:
+    /**
+     * @brief 計算封閉路徑長度 (加總順序與 ParallelEvaluator 相同)
+     * @param path 城市存取順序 (長度 n)
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量
+     * @return 路徑總長
+     */
+    static double tourLength(const std::vector<int>& path, const std::vector<double>& distMatrix, int n);
+
+    /**
+     * @brief 順序交叉 (Order Crossover, OX)
+     * * 繼承 p1 的 [start, end] 片段，其餘位置自 end + 1 起環狀填入 p2 中尚未出現的城市。
+     * * 要求子代雜湊 (hash 非空) 時：若已知 p2 的雜湊且片段長度 L 小於 n / 4，
+     * 由 p2 的雜湊 XOR 掉碰觸片段城市的邊 (最多 2L 條)、補上跨越片段的橋接邊與片段本身的邊，
+     * 約 4L 次邊金鑰運算；否則改以 TourHash::compute 重新計算。
+     * @param p1 親代 1 的路徑
+     * @param p2 親代 2 的路徑
+     * @param start 片段起點 (0 ≤ start < end)
+     * @param end 片段終點 (end < n)
+     * @param child 輸出的子代路徑 (會調整為長度 n)
+     * @param hash [out] 子代的路徑雜湊 (可為空，代表不需要)
+     * @param p2Hash p2 的路徑雜湊 (0 代表未知)
+     */
+    static void crossoverOX(const std::vector<int>& p1, const std::vector<int>& p2, int start, int end,
+                            std::vector<int>& child, std::uint64_t* hash = nullptr, std::uint64_t p2Hash = 0);
+
+private:
+    template <int MaxN>
+    static void crossoverOXImpl(const int* p1, const int* p2, int n, int start, int end, int* child,
+                                std::uint64_t* hash, std::uint64_t p2Hash);
+
+    static void crossoverOXGeneric(const int* p1, const int* p2, int n, int start, int end, int* child,
+                                   std::uint64_t* hash, std::uint64_t p2Hash);
+};
+
+#endif
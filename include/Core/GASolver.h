@@ -3,8 +3,36 @@
 
 #include "Core/Types.h"
 #include "Core/ParallelEvaluator.h"
+#include "Core/PopulationHeap.h"
+#include "Core/FitnessCache.h"
+#include "Core/NumaTopology.h"
+#include "Core/HeldKarpBound.h"
+#include "Core/ProblemInstance.h"
+#include "Core/HugePageArena.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+/**
+ * @struct MemoryFootprint
+ * @brief 求解器記憶體用量 (位元組)，依元件分項
+ * * 以容器容量 (capacity) 計算，反映實際保留的記憶體；不含配置器的額外負擔與適應度快取。
+ */
+struct MemoryFootprint {
+    std::size_t distanceTable = 0; /**< 距離矩陣 (含 NUMA 節點複本) */
+    std::size_t neighborLists = 0; /**< 2-Opt 近鄰清單 */
+    std::size_t population = 0;    /**< 族群：個體本身與各自的路徑 */
+    std::size_t scratch = 0;       /**< 演化暫存：排名鍵、SUS 親代池、穩態堆積與大分頁配置區 */
+    PageBacking distanceBacking = PageBacking::Regular; /**< 距離矩陣的分頁方式 */
+
+    /** @brief 合計 */
+    std::size_t total() const { return distanceTable + neighborLists + population + scratch; }
+};
+
 /**
  * @class GASolver
  * @brief 遺傳演算法求解器，專用於解決旅行推銷員問題 (TSP)
@@ -20,9 +48,20 @@ public:
      */
     GASolver(const GAConfig& config, const std::vector<City>& cities);
 
+    /**
+     * @brief 建構子：使用共享的唯讀實例 (不複製座標、不重建距離矩陣)
+     * * 多個求解器 (或同一實例的多次求解) 可共用同一份實例；城市編號以實例為準，
+     * 忽略 config.renumberCities。resolve() 套用變更時會另建新實例，其他持有者不受影響。
+     * @param config GA 的參數設定 (cityCount 必須等於實例的城市數)
+     * @param instance 共享實例
+     * @throw std::runtime_error 實例為空或城市數不符
+     */
+    GASolver(const GAConfig& config, std::shared_ptr<const ProblemInstance> instance);
+
     /**
      * @brief 初始化族群
-     * 隨機產生初始路徑序列，並執行初次的適應度評估。
+     * 依 GAConfig 的組成比例，以最近鄰居法、貪婪邊法、空間填充曲線或隨機排列產生初始路徑
+     * (啟用 useParallel 時分批平行建構)，並執行初次的適應度評估。
      */
     void initPopulation();
 
@@ -30,17 +69,218 @@ public:
      * @brief 執行主演化循環 (Main Evolution Loop)
      * * 流程包含：排序、精英保留、錦標賽選擇、順序交叉 (OX)、交換突變及族群更新。
      * 每一代演化後會透過 Callback 回報當前進度。
+     * 啟用 computeLowerBound / targetGap 時，同時在背景計算 Held-Karp 下界，
+     * 並於差距低於 targetGap 時提前結束。
+     * 城市數不超過 exactThreshold 時直接以 ExactSolver 求出最佳解 (僅回報一次進度)。
      * @return 返回演化過程中找到的最佳個體 (Individual)
      */
     Individual solve();
 
+    /**
+     * @brief 增量重新求解 (Warm-Start Re-Solve)
+     * * 針對城市集合小幅變動的動態實例：
+     * 1. 距離矩陣只重算變動城市的列與欄 (新增 / 移除時其餘元素僅搬移，不重算 sqrt)；
+     * 2. 近鄰清單只更新受影響的城市；
+     * 3. 既有族群逐一修補：刪除已移除的城市，再以最便宜插入法 (Cheapest Insertion)
+     *    放回新增與移動過的城市，每個個體的成本為 $O(k \cdot n)$ ($k$ 為變動數)；
+     * 4. 由修補後的族群繼續演化。
+     * 尚未求解過 (族群不完整) 時，套用變更後改為從頭初始化。
+     * @param delta 變更內容 (索引以變更前的編號為準)
+     * @param generations 繼續演化的代數 (0 代表沿用 GAConfig::generations)
+     * @return 新實例的最佳個體 (以變更後的城市索引表示)
+     * @throw std::runtime_error 索引越界、重複移除或移動已移除的城市
+     */
+    Individual resolve(const InstanceDelta& delta, int generations = 0);
+
+    /**
+     * @brief 取得目前實例的城市列表 (依外部索引排列，反映所有已套用的變更)
+     */
+    std::vector<City> getCities() const;
+
+    /**
+     * @brief 取得目前使用的共享實例 (可交給其他求解器重複使用)
+     */
+    std::shared_ptr<const ProblemInstance> getInstance() const { return m_instance; }
+
     /**
      * @brief 獲取當前族群中最優秀的個體
      * @return 當前代數中距離最短的個體副本
      */
     Individual getBestIndividual() const;
 
+    /**
+     * @brief 取得最近一次 solve() 期間計算出的 Held-Karp 下界
+     * @return 下界 (未啟用 computeLowerBound / targetGap 時為 0)
+     */
+    double getLowerBound() const { return m_lowerBound; }
+
+    /**
+     * @brief 取得當前最佳個體相對於下界的可證明差距 (UB - LB) / LB
+     * @return 差距比例 (無下界時為無限大)
+     */
+    double getOptimalityGap() const;
+
+    /**
+     * @brief 產生記憶體配置報告 (NUMA Placement Report)
+     * * 逐行列出距離矩陣、各節點複本與部分族群路徑的頁面實際所在節點，
+     * 用於確認 numaAware 的 First-Touch 配置是否生效。
+     * @return 多行文字報告
+     */
+    std::string getMemoryPlacementReport() const;
+
+    /**
+     * @brief 統計目前各元件的記憶體用量
+     */
+    MemoryFootprint getMemoryFootprint() const;
+
+    /**
+     * @brief 在建立求解器前估計記憶體用量的峰值 (供工作節點的容量規劃)
+     * * 世代模式在每代結束前同時持有新舊兩個族群，因此族群以兩倍計算；近鄰清單僅在
+     * 城市數達 neighborListThreshold 時計入。NUMA 複本數取決於執行時的拓撲，不在估計之內。
+     * @param config GA 參數設定
+     * @return 各元件的估計用量
+     */
+    static MemoryFootprint estimateFootprint(const GAConfig& config);
+
+    /**
+     * @brief 產生記憶體用量報告 (各元件 MB 數與距離矩陣的分頁方式)
+     * @return 多行文字報告
+     */
+    std::string getMemoryFootprintReport() const;
+
 private:
+    /**
+     * @brief 建立各 NUMA 節點的距離矩陣複本
+     * * 每份複本由綁定在該節點 CPU 上的執行緒複製產生，依 First-Touch 原則落在本地記憶體。
+     * 單一節點的機器不建立複本。
+     */
+    void buildNodeReplicas();
+
+    /**
+     * @brief 建構族群中 [begin, end) 區段的初始路徑
+     * @param begin 起始索引
+     * @param end 結束索引 (不含)
+     * @param candidates 貪婪邊法使用的近鄰清單
+     */
+    void buildInitialTours(int begin, int end, const std::vector<std::vector<int>>& candidates);
+
+    /**
+     * @brief 套用實例變更：更新城市、距離矩陣、近鄰清單與快取
+     * @param delta 變更內容
+     * @param oldToNew [out] 舊內部編號 → 新內部編號 (移除者為 -1)
+     * @param reinsert [out] 需重新插入路徑的新內部編號 (移動與新增的城市)
+     */
+    void applyDelta(const InstanceDelta& delta, std::vector<int>& oldToNew, std::vector<int>& reinsert);
+
+    /**
+     * @brief 修補單一路徑：重新編號、刪除失效城市，並以最便宜插入法放回 reinsert 中的城市
+     */
+    void repairPath(std::vector<int>& path, const std::vector<int>& oldToNew, const std::vector<int>& reinsert) const;
+
+    /**
+     * @brief 是否以 ExactSolver 取代演化 (城市數不超過 exactThreshold)
+     */
+    bool useExactSolver() const;
+
+    /**
+     * @brief 以位元遮罩 DP 求出最佳解，並將其設為唯一的族群成員
+     * @return 最佳個體 (原始城市索引)
+     */
+    Individual solveExact();
+
+    /**
+     * @brief 由目前族群繼續演化 (solve 與 resolve 共用)
+     * * 負責背景下界計算的啟停，並依設定分派至世代或穩態循環。
+     * @param generations 演化代數
+     * @return 最佳個體 (原始城市索引)
+     */
+    Individual evolve(int generations);
+
+    /**
+     * @brief 世代演化循環 (Generational Evolution Loop)
+     * * 每代整批繁衍、平行評估並排序，保留前 5% 精英。
+     * @param generations 演化代數
+     * @return 返回演化過程中找到的最佳個體
+     */
+    Individual solveGenerational(int generations);
+
+    /**
+     * @brief 管線化世代循環 (Pipelined Generational Loop)
+     * * 取消「全部繁衍 → 全部評估 → 排序 → 拋光」的階段屏障：
+     * 子代以 pipelineChunkSize 為單位切成任務，每個任務在同一執行緒上連續完成
+     * 選擇、交叉、突變、評估與 (依 localSearchCount 比例) 2-Opt，資料留在該核心的快取中；
+     * 上一代最佳個體的 2-Opt 拋光則作為獨立任務與繁衍同時進行。
+     * 世代之間只剩下等待所有任務完成與 $O(P)$ 的精英部分排序。
+     * @param generations 演化代數
+     * @return 返回演化過程中找到的最佳個體
+     */
+    Individual solvePipelined(int generations);
+
+    /**
+     * @brief 產生 count 個子代 (選擇 → 交叉 → 突變) 寫入 out[0, count)，可由多個執行緒同時呼叫
+     * * 啟用 rejectDuplicates 時，與精英或本次產生的其他子代重複者以交換擾動 (不同呼叫之間的重複不檢查)。
+     * @param out 輸出位置
+     * @param count 子代數
+     * @param eliteHashes 精英的路徑雜湊 (啟用 rejectDuplicates 時用於拒絕重複)
+     */
+    void breedInto(Individual* out, int count, const std::vector<std::uint64_t>& eliteHashes);
+
+    /**
+     * @brief 管線化任務：產生、評估並選擇性拋光 next[begin, end) 的子代
+     * @param next 下一代族群 (各任務寫入互不重疊的區段)
+     * @param begin 起始索引
+     * @param end 結束索引 (不含)
+     * @param polishProbability 每個子代執行 2-Opt 的機率
+     * @param eliteHashes 精英的路徑雜湊 (啟用 rejectDuplicates 時用於拒絕重複)
+     */
+    void breedChunk(std::vector<Individual>& next, int begin, int end, double polishProbability,
+                    const std::vector<std::uint64_t>& eliteHashes);
+
+    /**
+     * @brief 穩態演化循環 (Steady-State Evolution Loop)
+     * * 個體固定在族群槽位中，以索引式最小-最大堆積維護最佳與最差者。
+     * 子代分批產生並平行評估後逐一插入：若優於被取代者 (最差個體或錦標賽落敗者)
+     * 則直接覆寫該槽位，每個子代的維護成本為 $O(\log P)$，無需整代複製與排序。
+     * @param generations 演化代數
+     * @return 返回演化過程中找到的最佳個體
+     */
+    Individual solveSteadyState(int generations);
+
+    /**
+     * @brief 將內部 (重新編號後) 的路徑換回輸入時的城市索引
+     * @param ind 內部個體
+     * @return 以原始索引表示的個體 (未啟用 renumberCities 時原樣回傳)
+     */
+    Individual toOriginalIds(Individual ind) const;
+
+    /**
+     * @brief 回報當代最佳距離給背景下界計算，並判斷是否已達成 targetGap
+     * @param bestDistance 目前最佳距離
+     * @return 是否應提前結束演化
+     */
+    bool reachedTargetGap(double bestDistance);
+
+    /**
+     * @brief 判斷是否應提前結束演化：已達成 targetGap、stopFlag 已被設定，或已超過 timeLimitSeconds
+     * @param bestDistance 目前最佳距離
+     * @return 是否應提前結束演化
+     */
+    bool shouldStop(double bestDistance);
+
+    /**
+     * @brief 以候選個體更新歷史最佳解，較上次回報更好時觸發 onBestImproved
+     * @param gen 當前代數
+     * @param bestEver [in/out] 歷史最佳個體
+     * @param candidate 本代最佳個體
+     */
+    void updateBest(int gen, Individual& bestEver, const Individual& candidate);
+
+    /**
+     * @brief 反向錦標賽：隨機抽選 $k$ 個個體並回傳其中最差者的索引
+     * @return 被選為取代對象的族群索引
+     */
+    int selectTournamentLoser();
+
     // --- 核心演化算子 (Internal Evolutionary Operators) ---
     
     /**
@@ -53,9 +293,34 @@ private:
     /**
      * @brief 錦標賽選擇 (Tournament Selection)
      * 從族群中隨機抽選 $k$ 個個體，回傳其中表現最佳者，平衡選擇壓力與多樣性。
-     * @return 被選中的精英個體
+     * 只比較距離並回傳參考，不複製任何路徑。
+     * @return 被選中的個體 (參考在族群被改寫前有效)
+     */
+    const Individual& selectionTournament();
+
+    /**
+     * @brief 依 selectionMode 選出一個親代
+     * * Rank 與 StochasticUniversal 需要本代先呼叫 rankPopulation() / prepareSelection()。
+     * 可由多個執行緒同時呼叫 (管線化模式)。
+     * @return 被選中的個體 (參考在族群被改寫前有效)
+     */
+    const Individual& selectParent();
+
+    /**
+     * @brief 以 (距離, 索引) 鍵陣列排名族群，個體本身不移動
+     * * 先以 $O(P)$ 找出最佳個體並與索引 0 交換 (維持「最佳者位於索引 0」的約定)，
+     * 再建立鍵陣列：Rank 模式需要完整排名，故排序鍵陣列；其餘模式只以 nth_element
+     * 取出前 topK 名並排序 (平行模式下各執行緒先取分段的前 topK 名再合併)。
+     * 結果存於 m_rankKeys，前 topK 項依距離遞增。
+     * @param topK 需要依序排列的前段名次數 (精英數)
+     */
+    void rankPopulation(int topK);
+
+    /**
+     * @brief 為 StochasticUniversal 模式預先抽出本代全部親代
+     * @param count 需要的親代數量
      */
-    Individual selectionTournament();
+    void prepareSelection(int count);
     
     /**
      * @brief 順序交叉 (Order Crossover, OX)
@@ -76,24 +341,103 @@ private:
     /**
      * @brief 局部搜尋優化 (2-Opt Local Search)
      * 針對個體路徑進行邊交換優化，消除交叉路徑，是提升精準度的關鍵算子。
+     * 城市數達 neighborListThreshold 時改用 LocalSearch::twoOptNeighborList，
+     * 以近鄰清單取代 $O(n^2)$ 全掃描、以 $O(\sqrt{n})$ 翻轉取代 std::reverse；
+     * 其餘情況使用 LocalSearch::twoOptBlocked 的區塊化全鄰域掃描。
      * @param ind 欲進行局部優化的個體
      */
     void apply2Opt(Individual& ind);
 
+    /**
+     * @brief 對當代最佳個體進行 Memetic 拋光
+     * * 以路徑雜湊辨識「已拋光過的同一條迴路」：精英在多代間原封不動地保留時，
+     * 再次執行 2-Opt 只會得到相同的局部最優解，因此直接跳過整個 $O(n^2)$ 掃描。
+     * 城市數達 parallelPolishThreshold 時改用 LocalSearch::twoOptParallel，讓單一大型路徑的拋光使用多核心。
+     * @param ind 欲拋光的個體
+     */
+    void polishBest(Individual& ind);
+
+    /**
+     * @brief 隨機抽選 count 個互不重複的族群索引，作為額外 2-Opt 的對象
+     * @param count 抽選數量 (<= 0 時回傳空集合)
+     */
+    std::vector<int> pickPolishTargets(int count);
+
+    /**
+     * @brief 對指定索引的個體執行 2-Opt 並更新適應度 (啟用 useParallel 時分批平行)
+     * * 控制 Memetic 強度：localSearchCount 越大，每代投入局部搜尋的時間越多。
+     * @param indices 族群索引
+     */
+    void polishIndividuals(const std::vector<int>& indices);
+
+    /**
+     * @brief 確保個體帶有有效的路徑雜湊值
+     */
+    static void ensureHash(Individual& ind);
+
+    /**
+     * @brief 取得啟用中的適應度快取 (未啟用時回傳 nullptr)
+     */
+    FitnessCache* activeCache() { return m_config.useFitnessCache ? &m_cache : nullptr; }
+
+    /**
+     * @brief 取得 2-Opt 使用的近鄰清單 (城市數低於 neighborListThreshold 時為空，代表全鄰域掃描)
+     */
+    const std::vector<std::vector<int>>& neighborLists() const;
+
     // --- 私有成員變數 (Internal State) ---
 
     /** @brief 演算法參數配置 */
     GAConfig m_config;
 
-    /** @brief 原始城市座標資料 */
-    std::vector<City> m_cities;
+    /** @brief 共享的唯讀實例：城市座標、內部編號對照、扁平化距離矩陣與近鄰清單 */
+    std::shared_ptr<const ProblemInstance> m_instance;
 
-    /** @brief 扁平化距離矩陣 ($N \times N$)，提升快取友善度 */
-    std::vector<double> m_distMatrix;
+    /** @brief NUMA 拓撲 (僅在 numaAware 時偵測) */
+    NumaTopology m_topology;
+
+    /** @brief 各 NUMA 節點的距離矩陣複本 (索引為節點編號) */
+    std::vector<std::vector<double>> m_distReplicas;
 
     /** @brief 當前代數的族群集合 */
     std::vector<Individual> m_population;
 
+    /** @brief 大分頁配置區 (僅在 useHugePages 且演化暫存達 2 MB 時建立；必須宣告於使用它的容器之前) */
+    std::unique_ptr<HugePageArena> m_arena;
+
+    /** @brief 本代的 (距離, 族群索引) 排名鍵，前段為依序排列的精英 */
+    std::vector<std::pair<double, int>, ArenaAllocator<std::pair<double, int>>> m_rankKeys;
+
+    /** @brief SUS 模式本代抽出的親代索引 (已打亂順序) */
+    std::vector<int, ArenaAllocator<int>> m_selectionPool;
+
+    /** @brief SUS 親代池的讀取位置 (管線化模式下由多個執行緒共用) */
+    std::atomic<std::size_t> m_selectionCursor{0};
+
+    /** @brief 穩態模式使用的索引式最小-最大堆積 */
+    PopulationHeap m_heap;
+
+    /** @brief 以路徑雜湊為鍵的適應度快取 */
+    FitnessCache m_cache;
+
+    /** @brief 最近一次 2-Opt 拋光結果的路徑雜湊 */
+    std::uint64_t m_lastPolishedHash = 0;
+
+    /** @brief 穩態模式下族群中各路徑雜湊的出現次數 (用於拒絕重複子代) */
+    std::unordered_map<std::uint64_t, int> m_hashCounts;
+
+    /** @brief 背景執行的 Held-Karp 下界計算 (僅在 solve() 期間存在) */
+    std::unique_ptr<HeldKarpBound> m_bound;
+
+    /** @brief 最近一次 solve() 得到的下界 */
+    double m_lowerBound = 0.0;
+
+    /** @brief 本次 solve() / resolve() 的開始時間 (timeLimitSeconds 的計時起點) */
+    std::chrono::steady_clock::time_point m_solveStart;
+
+    /** @brief 最近一次透過 onBestImproved 回報的距離 */
+    double m_reportedBest = 0.0;
+
     /** @brief 平行評估器，負責調度多執行緒計算資源 */
     ParallelEvaluator m_evaluator;
 };
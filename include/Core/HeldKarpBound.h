@@ -0,0 +1,142 @@
+#ifndef HELD_KARP_BOUND_H
+#define HELD_KARP_BOUND_H
+
+#include "Core/Types.h"
+#include <atomic>
+#include <future>
+#include <vector>
+
+/**
+ * @class HeldKarpBound
+ * @brief Held-Karp 1-Tree 下界 (Subgradient Optimization)
+ * * 對任意節點權重 $\pi$，以邊權 $c_{ij} + \pi_i + \pi_j$ 求最小 1-Tree
+ * (去掉特殊節點後的最小生成樹，再接上特殊節點最短的兩條邊)，
+ * 其權重減去 $2\sum\pi$ 即為最佳迴路長度的合法下界 $L(\pi)$。
+ * 次梯度法沿 $g_i = \deg_i - 2$ 調整 $\pi$ 以最大化 $L(\pi)$，
+ * 步長採 Polyak 公式 $t = \lambda (UB - L) / \|g\|^2$，$\lambda$ 在停滯時減半。
+ * * 平行化方式：多條以不同初始 $\lambda$ 與特殊節點出發的次梯度鏈同時執行，
+ * 任一鏈在任一迭代得到的 $L(\pi)$ 都是合法下界，因此共享取最大值即可，無需同步 $\pi$。
+ * 每次迭代以 $O(n^2)$ 的 Prim 演算法求 1-Tree，不需要任何額外記憶體結構。
+ */
+class HeldKarpBound {
+public:
+    /**
+     * @brief 建構子
+     * @param distMatrix 扁平化距離矩陣 (需在物件使用期間保持有效)
+     * @param n 城市數量
+     */
+    HeldKarpBound(const std::vector<double>& distMatrix, int n);
+
+    /**
+     * @brief 解構子：若背景計算仍在執行，先要求停止並等待結束
+     */
+    ~HeldKarpBound();
+
+    HeldKarpBound(const HeldKarpBound&) = delete;
+    HeldKarpBound& operator=(const HeldKarpBound&) = delete;
+
+    /**
+     * @brief 執行次梯度最佳化
+     * * 可在背景執行緒呼叫，並透過 upperBound / stop 與求解器即時互動。
+     * @param upperBound 目前已知最佳迴路長度 (每次迭代重新讀取；nullptr 時以最近鄰居法 + 2-Opt 自行估計)
+     * @param stop 外部停止旗標 (可為 nullptr)
+     * @param chains 平行次梯度鏈數量 (0 代表使用 hardware_concurrency)
+     * @param maxIterations 每條鏈的迭代上限 (0 代表 $\max(1000, 50n)$)
+     * @return 最佳下界
+     */
+    double run(const std::atomic<double>* upperBound = nullptr,
+               const std::atomic<bool>* stop = nullptr,
+               unsigned int chains = 0,
+               int maxIterations = 0);
+
+    /**
+     * @brief 以 std::async 在背景啟動次梯度最佳化 (與求解器並行)
+     * @param initialUpper 初始上界 (通常為初始族群的最佳距離)
+     * @param chains 平行次梯度鏈數量 (預設 1，避免與求解器搶占核心)
+     */
+    void start(double initialUpper, unsigned int chains = 1);
+
+    /**
+     * @brief 回報更短的迴路，讓背景計算的 Polyak 步長使用較緊的上界
+     * @param upper 目前已知最佳迴路長度
+     */
+    void updateUpperBound(double upper);
+
+    /**
+     * @brief 要求背景計算停止並等待結束
+     * @return 最佳下界
+     */
+    double finish();
+
+    /**
+     * @brief 目前為止的最佳下界 (執行期間亦可由其他執行緒讀取)
+     */
+    double bestBound() const { return m_best.load(); }
+
+    /**
+     * @brief 下界是否已證明等於最佳迴路長度 (1-Tree 恰為一條迴路，或下界已追上上界)
+     * * 此時次梯度計算會停止；求解器本身的迴路是否已達最佳仍需以 gap() 判斷。
+     */
+    bool isOptimal() const { return m_optimal.load(); }
+
+    /**
+     * @brief 便利函式：由城市座標建立距離矩陣後計算下界
+     * @param cities 城市座標列表
+     * @param chains 平行次梯度鏈數量 (0 代表使用 hardware_concurrency)
+     * @return 最佳下界
+     */
+    static double compute(const std::vector<City>& cities, unsigned int chains = 0);
+
+    /**
+     * @brief 計算相對最佳性差距 (UB - LB) / LB
+     * @param tourLength 迴路長度 (上界)
+     * @param lowerBound 下界
+     * @return 差距比例 (下界無效時回傳無限大)
+     */
+    static double gap(double tourLength, double lowerBound);
+
+private:
+    /**
+     * @brief 單條次梯度鏈
+     * @param lambda0 初始步長係數
+     * @param special 1-Tree 的特殊節點
+     * @param fallbackUpper upperBound 為 nullptr 時使用的上界
+     */
+    void chain(double lambda0, int special, double fallbackUpper,
+               const std::atomic<double>* upperBound, const std::atomic<bool>* stop, int maxIterations);
+
+    /**
+     * @brief 在權重 pi 下求最小 1-Tree
+     * @param pi 節點權重
+     * @param special 特殊節點
+     * @param degree [out] 各節點在 1-Tree 中的度數
+     * @return $L(\pi)$
+     */
+    double oneTree(const std::vector<double>& pi, int special, std::vector<int>& degree) const;
+
+    /**
+     * @brief 以 CAS 迴圈更新共享下界 (取最大值)
+     */
+    void publish(double bound);
+
+    /** @brief 扁平化距離矩陣 (不持有) */
+    const std::vector<double>& m_distMatrix;
+
+    /** @brief 城市數量 */
+    int m_n;
+
+    /** @brief 所有鏈共享的最佳下界 */
+    std::atomic<double> m_best;
+
+    /** @brief 下界是否已證明等於最佳迴路長度 */
+    std::atomic<bool> m_optimal;
+
+    /** @brief 背景模式的上界與停止旗標 */
+    std::atomic<double> m_upper;
+    std::atomic<bool> m_stop;
+
+    /** @brief 背景計算任務 */
+    std::future<double> m_task;
+};
+
+#endif
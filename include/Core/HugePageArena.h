@@ -0,0 +1,144 @@
+#ifndef HUGE_PAGE_ARENA_H
+#define HUGE_PAGE_ARENA_H
+
+#include <cstddef>
+#include <new>
+
+/**
+ * @enum PageBacking
+ * @brief 記憶體區段實際使用的分頁方式
+ */
+enum class PageBacking {
+    Regular,     /**< 一般 4 KB 分頁 (平台不支援大分頁或設定失敗時的退化) */
+    Transparent, /**< 透明大分頁 (THP)：2 MB 對齊並以 madvise(MADV_HUGEPAGE) 提示核心 */
+    Explicit     /**< 明確的 2 MB 大分頁 (MAP_HUGETLB，需預先保留 hugetlbfs 頁面) */
+};
+
+/**
+ * @class HugePageArena
+ * @brief 以 2 MB 大分頁為後盾的連續配置區 (Bump Arena)
+ * * n 達數千時，距離矩陣可達數百 MB；以 4 KB 分頁映射時，
+ * evaluateIndividual 與 apply2Opt 的隨機查表除了快取未命中之外還會伴隨 TLB 未命中。
+ * 距離矩陣沿用 std::vector<double> 容器，只以 advise() 在首次寫入前提示透明大分頁；本類別供求解器的演化暫存
+ * (排名鍵、SUS 親代池) 配置，且只在暫存達一個大分頁時才建立。族群路徑仍是各個體獨立的 std::vector<int>，不在配置區內。
+ * 本類別一次保留整段區域，依序嘗試：
+ * 1. MAP_HUGETLB 的明確大分頁 (僅在 explicitPages 為 true 時嘗試)；
+ * 2. 以 2 MB 對齊的匿名映射並 madvise(MADV_HUGEPAGE)，由核心在首次寫入時配置透明大分頁；
+ * 3. 一般分頁 (非 Linux 平台或上述皆失敗)。
+ * 區段內以遞增指標配置，不支援個別釋放；reset() 或解構時一次歸還，也不會在堆積上留下碎片。
+ */
+class HugePageArena {
+public:
+    /** @brief 大分頁大小 (x86-64 / AArch64 的 2 MB) */
+    static constexpr std::size_t kHugePageSize = std::size_t(2) << 20;
+
+    /**
+     * @brief 保留配置區
+     * @param capacity 容量 (位元組，向上取整至 2 MB)
+     * @param explicitPages 是否先嘗試 MAP_HUGETLB
+     * @throw std::bad_alloc 無法保留任何記憶體
+     */
+    explicit HugePageArena(std::size_t capacity, bool explicitPages = false);
+
+    /**
+     * @brief 解構子：歸還整段區域
+     */
+    ~HugePageArena();
+
+    HugePageArena(const HugePageArena&) = delete;
+    HugePageArena& operator=(const HugePageArena&) = delete;
+
+    /**
+     * @brief 自區段配置一塊記憶體
+     * @param bytes 大小
+     * @param alignment 對齊 (2 的冪次)，預設為快取行
+     * @return 起始位址；剩餘空間不足時回傳 nullptr (由呼叫端退回一般配置)
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment = 64);
+
+    /**
+     * @brief 判斷位址是否位於本區段內
+     */
+    bool owns(const void* p) const {
+        return p >= m_base && p < static_cast<const char*>(m_base) + m_capacity;
+    }
+
+    /**
+     * @brief 捨棄所有配置 (先前取得的位址全部失效)
+     */
+    void reset() { m_used = 0; }
+
+    /** @brief 區段容量 (位元組) */
+    std::size_t capacity() const { return m_capacity; }
+
+    /** @brief 已配置的位元組數 (含對齊填補) */
+    std::size_t used() const { return m_used; }
+
+    /** @brief 區段實際的分頁方式 */
+    PageBacking backing() const { return m_backing; }
+
+    /**
+     * @brief 對既有配置 (例如 std::vector 的緩衝區) 提示使用透明大分頁
+     * * 只有範圍內完整對齊的 2 MB 區塊會被提示；必須在首次寫入前呼叫，核心才會直接以大分頁滿足缺頁。
+     * @param data 起始位址
+     * @param bytes 大小
+     * @return 提示成功時為 Transparent，範圍不足 2 MB 或平台不支援時為 Regular
+     */
+    static PageBacking advise(void* data, std::size_t bytes);
+
+    /**
+     * @brief 分頁方式的顯示名稱
+     */
+    static const char* backingName(PageBacking backing);
+
+private:
+    void* m_base = nullptr;
+    std::size_t m_capacity = 0;
+    std::size_t m_used = 0;
+    std::size_t m_mapped = 0; // 實際映射的大小 (含對齊用的額外空間)
+    void* m_mapping = nullptr;
+    PageBacking m_backing = PageBacking::Regular;
+};
+
+/**
+ * @class ArenaAllocator
+ * @brief 自 HugePageArena 配置的標準配置器 (可用於 std::vector 等容器)
+ * * 未指定區段或區段已滿時退回 ::operator new；歸還區段內的記憶體是空操作 (隨區段一次釋放)。
+ * 容器的生命週期不得超過其區段。
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+    explicit ArenaAllocator(HugePageArena* arena) noexcept : m_arena(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : m_arena(other.arena()) {}
+
+    T* allocate(std::size_t count) {
+        std::size_t bytes = count * sizeof(T);
+        if (m_arena) {
+            std::size_t alignment = alignof(T) > 64 ? alignof(T) : 64;
+            if (void* p = m_arena->allocate(bytes, alignment)) return static_cast<T*>(p);
+        }
+        return static_cast<T*>(::operator new(bytes));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        if (m_arena && m_arena->owns(p)) return;
+        ::operator delete(p);
+    }
+
+    HugePageArena* arena() const noexcept { return m_arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return m_arena == other.arena(); }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return m_arena != other.arena(); }
+
+private:
+    HugePageArena* m_arena = nullptr;
+};
+
+#endif
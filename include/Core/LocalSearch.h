@@ -0,0 +1,117 @@
+#ifndef LOCAL_SEARCH_H
+#define LOCAL_SEARCH_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class LocalSearch
+ * @brief 局部搜尋核心 (Local Search Kernels)
+ * * 收錄與 GASolver 族群狀態無關的 2-Opt 實作，輸入為路徑序列與扁平化距離矩陣。
+ * 所有成員均為靜態 (static)，可被求解器或其他模組直接呼叫。
+ * * 各公開函式可選擇性接收路徑雜湊 (TourHash)：每套用一次移動即 XOR 上 TourHash::twoOptDelta，
+ * 結束時雜湊與路徑一致，不需再以 $O(n)$ 重新計算。
+ */
+class LocalSearch {
+public:
+    /**
+     * @brief 近鄰清單驅動的 2-Opt (Neighbor-List 2-Opt on a Two-Level List)
+     * * 只考慮「新邊的一端落在另一端的 k 近鄰清單內」的移動，並以待處理佇列
+     * (Don't-Look Bits) 只重新檢查端點有變動的城市。路徑以 TwoLevelList 表示，
+     * 每次翻轉為 $O(\sqrt{n})$，使萬級城市的局部搜尋不再受 $O(n)$ 翻轉與 $O(n^2)$ 掃描拖累。
+     * 進入與離開時才與 std::vector<int> 互相轉換。
+     * @param path [in/out] 欲優化的路徑
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量
+     * @param neighbors neighbors[c] 為城市 c 依距離遞增的近鄰清單
+     * @param hash [in/out] 路徑雜湊 (可為空)
+     * @return 路徑總距離的減少量 (>= 0)
+     */
+    static double twoOptNeighborList(std::vector<int>& path,
+                                     const std::vector<double>& distMatrix,
+                                     int n,
+                                     const std::vector<std::vector<int>>& neighbors,
+                                     std::uint64_t* hash = nullptr);
+
+    /**
+     * @brief 區塊化全鄰域 2-Opt (Blocked Full-Neighborhood 2-Opt)
+     * * 固定 i 時，移除邊 (a, b) = (path[i-1], path[i]) 與 (c, d) = (path[j], path[j+1]) 的增益為
+     * $d(a,b) + d(c,d) - d(a,c) - d(b,d)$。其中 $d(c,d)$ 取自隨路徑維護的「邊長陣列」(連續記憶體)，
+     * $d(a,c)$、$d(b,d)$ 則是矩陣第 a、b 列依 path 索引的收集 (gather)。
+     * 每次計算 kBlock 個 j 的增益 (執行期偵測到 AVX2 時以 `_mm256_i32gather_pd` 一次處理 4 個，不需 -march=native)，
+     * 再套用區塊內增益最大的移動。重複掃描直到沒有改善，結果為 2-Opt 局部最優。
+     * * 搜尋範圍與 GASolver 原本的純量迴圈相同 (1 ≤ i < j ≤ n - 2，不含跨越尾端的邊)，
+     * 距離矩陣需對稱。
+     * @param path [in/out] 欲優化的路徑
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量
+     * @param hash [in/out] 路徑雜湊 (可為空)
+     * @return 路徑總距離的減少量 (>= 0)
+     */
+    static double twoOptBlocked(std::vector<int>& path, const std::vector<double>& distMatrix, int n,
+                                std::uint64_t* hash = nullptr);
+
+    /** @brief twoOptBlocked 每個區塊的候選 j 數量 */
+    static constexpr int kBlock = 64;
+
+    /**
+     * @brief twoOptBlocked 的增益計算是否使用 AVX2 路徑 (依執行期 CPU 偵測，結果快取)
+     */
+    static bool usesAvx2();
+
+    /**
+     * @brief 單一路徑的平行 2-Opt (Segment-Partitioned Parallel 2-Opt)
+     * * 將路徑位置切成 threads 個連續區段，每個執行緒只考慮「被移除的兩條邊都在自己區段內」的移動。
+     * 這類移動只會翻轉區段內部的子序列，因此各區段的改善彼此不衝突，可同時套用而不需鎖。
+     * 每回合結束後以半個區段長度旋轉切點，讓上一回合跨越邊界的邊落入區段內部；
+     * 連續兩個回合 (兩種切點) 都沒有改善後，再以序列版本收尾，補上跨區段的長距離移動。
+     * * 區段內的搜尋：提供近鄰清單時為近鄰 2-Opt (Don't-Look Bits)，否則為 twoOptBlocked 的全鄰域掃描。
+     * @param path [in/out] 欲優化的路徑
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量
+     * @param neighbors 近鄰清單 (可為空)
+     * @param threads 區段 / 執行緒數 (0 代表 hardware_concurrency)
+     * @param hash [in/out] 路徑雜湊 (可為空；各區段分別累積增量，回合結束時合併)
+     * @return 路徑總距離的減少量 (>= 0)
+     */
+    static double twoOptParallel(std::vector<int>& path,
+                                 const std::vector<double>& distMatrix,
+                                 int n,
+                                 const std::vector<std::vector<int>>& neighbors,
+                                 unsigned int threads = 0,
+                                 std::uint64_t* hash = nullptr);
+
+private:
+    /**
+     * @brief 首尾固定的區塊化 2-Opt：只改動 p[1..len-2]，p[0] 與 p[len-1] 不動
+     * @param p 路徑片段起點
+     * @param len 片段長度
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 矩陣維度 (城市總數)
+     * @param hash [in/out] 雜湊增量的累積處 (可為空)
+     */
+    static double twoOptBlockedRange(int* p, int len, const double* distMatrix, int n, std::uint64_t* hash);
+
+    /**
+     * @brief 區段內的近鄰 2-Opt (供 twoOptParallel 使用)
+     * * 只接受 owner 等於 segment 的城市，並只讀寫這些城市的 pos / queued 項目，
+     * 因此多個區段可同時在共用陣列上執行。
+     * @param p 完整路徑
+     * @param lo 區段起點位置 (含)
+     * @param hi 區段終點位置 (不含)
+     * @param hash [in/out] 雜湊增量的累積處 (可為空)
+     */
+    static double segmentNeighborTwoOpt(int* p, int lo, int hi, const double* distMatrix, int n,
+                                        const std::vector<std::vector<int>>& neighbors,
+                                        std::vector<int>& pos, const std::vector<int>& owner,
+                                        std::vector<char>& queued, int segment, std::uint64_t* hash);
+
+    /**
+     * @brief 計算一個區塊的 2-Opt 增益：gains[k] = dab + edge[k] - rowA[path[k]] - rowB[path[k + 1]]
+     * @return 區塊內的最大增益
+     */
+    static double blockGains(const double* rowA, const double* rowB, double dab,
+                           const int* path, const double* edge, int len, double* gains);
+};
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef NUMA_TOPOLOGY_H
+#define NUMA_TOPOLOGY_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class NumaTopology
+ * @brief NUMA 拓撲偵測與執行緒 / 記憶體配置工具
+ * * 在多插槽 (Multi-Socket) 機器上，記憶體頁面會配置在「第一次寫入它的執行緒」所在的節點
+ * (First-Touch Policy)。若距離矩陣由建構執行緒一次寫完、而評估執行緒在各插槽間任意漂移，
+ * 大部分查表都會變成跨節點存取。本類別提供：
+ * - 從 /sys/devices/system/node 讀取節點與 CPU 對應 (非 Linux 平台視為單一節點)；
+ * - 將目前執行緒綁定到指定 CPU；
+ * - 查詢一段記憶體實際落在哪些節點上 (move_pages 查詢模式)，用於回報配置結果。
+ * * 不依賴 libnuma，所有平台相關呼叫皆在無法使用時安全地退化。
+ */
+class NumaTopology {
+public:
+    /**
+     * @brief 偵測目前機器的 NUMA 拓撲
+     * @return 拓撲資訊；偵測失敗時回傳包含所有硬體執行緒的單一節點
+     */
+    static NumaTopology detect();
+
+    /** @brief NUMA 節點數量 */
+    int nodeCount() const { return static_cast<int>(m_nodeCpus.size()); }
+
+    /** @brief 指定節點上的 CPU 編號 */
+    const std::vector<int>& cpusOfNode(int node) const { return m_nodeCpus[node]; }
+
+    /**
+     * @brief 第 worker 個工作執行緒應綁定的節點 (各節點輪流分配，讓負載均勻分散到所有插槽)
+     */
+    int nodeForWorker(int worker) const { return worker % nodeCount(); }
+
+    /**
+     * @brief 第 worker 個工作執行緒應綁定的 CPU
+     */
+    int cpuForWorker(int worker) const;
+
+    /**
+     * @brief 將目前執行緒綁定到指定 CPU
+     * @param cpu CPU 編號
+     * @return 是否綁定成功 (非 Linux 平台恆為 false)
+     */
+    static bool pinCurrentThread(int cpu);
+
+    /**
+     * @brief 抽樣查詢一段記憶體的頁面所在節點，並產生一行文字報告
+     * * 例如 "distMatrix[node 0] (76.3 MB): node0 100.0%"。無法查詢時標示為 unknown。
+     * @param label 報告中顯示的名稱
+     * @param addr 記憶體起始位址
+     * @param bytes 記憶體長度
+     * @return 單行配置報告
+     */
+    static std::string describePlacement(const std::string& label, const void* addr, std::size_t bytes);
+
+private:
+    /** @brief 節點 → CPU 編號列表 */
+    std::vector<std::vector<int>> m_nodeCpus;
+};
+
+#endif
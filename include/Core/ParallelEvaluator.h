@@ -2,6 +2,9 @@
 #define PARALLEL_EVALUATOR_H
 
 #include "Core/Types.h"
+#include "Core/FitnessCache.h"
+#include "Core/NumaTopology.h"
+#include <utility>
 #include <vector>
 
 /**
@@ -21,13 +24,59 @@ public:
      * @param distMatrix 預計算的扁平化距離矩陣 (用於 O(1) 查表)
      * @param cityCount 城市總數
      * @param useParallel 是否啟用 std::async 並行處理
+     * @param cache 適應度快取 (可為 nullptr)；提供時會先以路徑雜湊查詢，命中則跳過距離計算
      */
     void evaluate(std::vector<Individual>& population, 
                   const std::vector<double>& distMatrix, 
                   int cityCount,
-                  bool useParallel);
+                  bool useParallel,
+                  FitnessCache* cache = nullptr);
+
+    /**
+     * @brief 啟用拓撲感知執行 (NUMA-Aware Placement)
+     * * 設定後，平行模式的第 i 個批次任務 (見 batchRange) 會先將自身綁定到 topology.cpuForWorker(i)，
+     * 並改用該 CPU 所在節點的距離矩陣複本 (replicas[node])，讓查表皆為本地記憶體存取。
+     * @param topology 拓撲資訊 (需在評估器使用期間保持有效；nullptr 代表停用)
+     * @param replicas 各節點的距離矩陣複本 (可為空，代表所有節點共用 evaluate 傳入的矩陣)
+     */
+    void setPlacement(const NumaTopology* topology, std::vector<const std::vector<double>*> replicas);
+
+    /**
+     * @brief 設定平行模式的執行緒數與啟動門檻
+     * @param threadCount 批次任務數 (0 代表使用 hardware_concurrency)
+     * @param parallelThreshold 族群大小超過此值才啟用平行評估
+     */
+    void setThreading(unsigned int threadCount, int parallelThreshold);
+
+    /**
+     * @brief 平行模式的批次任務數 (設定值，未設定時為 hardware_concurrency，至少 1)
+     */
+    unsigned int workerCount() const;
+
+    /**
+     * @brief 批次切分：第 batch 個批次負責的索引區間 [begin, end)
+     * * 評估器、族群初始化、繁衍與修補共用同一切分，第 i 個批次一律由綁定到 cpuForWorker(i) 的執行緒處理，
+     * 因此個體的路徑由之後評估它的節點首次寫入。各批次大小相差至多 1，批次數多於總數時部分批次為空。
+     * @param total 總數
+     * @param batches 批次數
+     * @param batch 批次編號 (0 ~ batches - 1)
+     * @return 索引區間
+     */
+    static std::pair<int, int> batchRange(int total, unsigned int batches, unsigned int batch);
 
 private:
+    /** @brief 批次任務數 (0 代表使用硬體執行緒數) */
+    unsigned int m_threadCount = 0;
+
+    /** @brief 啟用平行評估的最小族群大小 */
+    int m_parallelThreshold = 64;
+
+    /** @brief 拓撲資訊 (nullptr 代表不綁定執行緒) */
+    const NumaTopology* m_topology = nullptr;
+
+    /** @brief 各 NUMA 節點的距離矩陣複本 */
+    std::vector<const std::vector<double>*> m_replicas;
+
     /**
      * @brief 單個個體的路徑計算核心邏輯
      * * 此為純運算密集型 (CPU Bound) 函式，計算給定路徑的總歐幾里得距離。
@@ -35,8 +84,10 @@ private:
      * * @param ind 欲計算的個體引用
      * @param distMatrix 距離查表矩陣
      * @param cityCount 城市總數
+     * @param cache 適應度快取 (可為 nullptr)
      */
-    void evaluateIndividual(Individual& ind, const std::vector<double>& distMatrix, int cityCount);
+    void evaluateIndividual(Individual& ind, const std::vector<double>& distMatrix, int cityCount,
+                            FitnessCache* cache);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,81 @@
+#ifndef POPULATION_HEAP_H
+#define POPULATION_HEAP_H
+
+#include "Core/Types.h"
+#include <vector>
+
+/**
+ * @class PopulationHeap
+ * @brief 索引式最小-最大堆積 (Indexed Min-Max Heap)
+ * * 以個體在族群中的索引為元素、路徑距離為鍵值，同時支援 $O(1)$ 取得最佳 (最短) 與
+ * 最差 (最長) 個體，以及 $O(\log P)$ 的任意鍵值更新。
+ * 穩態 (Steady-State) 演化模式藉此取代每代一次的全族群排序：個體留在原位，
+ * 僅在子代取代某個槽位時調整堆積。
+ * * 偶數層為最小層 (Min Level)，奇數層為最大層 (Max Level)。
+ */
+class PopulationHeap {
+public:
+    /**
+     * @brief 以族群目前的距離建立堆積 (Floyd 式自底向上建構，$O(P)$)
+     * @param population 已完成評估的族群
+     */
+    void build(const std::vector<Individual>& population);
+
+    /**
+     * @brief 更新指定個體的鍵值並恢復堆積性質
+     * @param index 個體在族群中的索引
+     * @param key 新的鍵值 (路徑距離)
+     */
+    void update(int index, double key);
+
+    /**
+     * @brief 取得鍵值最小 (最佳) 個體的索引
+     */
+    int minIndex() const { return m_heap[0]; }
+
+    /**
+     * @brief 取得鍵值最大 (最差) 個體的索引
+     * 最大值必定位於根節點的兩個子節點之一 (或根節點本身)。
+     */
+    int maxIndex() const;
+
+    /**
+     * @brief 取得指定個體目前的鍵值
+     */
+    double key(int index) const { return m_keys[index]; }
+
+    /**
+     * @brief 堆積中的元素數量
+     */
+    int size() const { return static_cast<int>(m_heap.size()); }
+
+private:
+    /** @brief 判斷堆積位置是否位於最小層 */
+    static bool isMinLevel(int pos);
+
+    /**
+     * @brief 依層別比較兩個堆積位置
+     * 最小層時回傳 key(a) < key(b)，最大層時回傳 key(a) > key(b)。
+     */
+    bool better(int posA, int posB, bool minLevel) const;
+
+    /** @brief 交換兩個堆積位置並同步反向索引 */
+    void swapPos(int a, int b);
+
+    /** @brief 沿著同類層級 (祖父節點) 往上調整，回傳是否有移動 */
+    bool pushUpGrand(int pos, bool minLevel);
+
+    /** @brief 將位置 pos 的元素往下調整至子樹中正確的位置 */
+    void pushDown(int pos);
+
+    /** @brief 位置 → 個體索引 */
+    std::vector<int> m_heap;
+
+    /** @brief 個體索引 → 位置 */
+    std::vector<int> m_pos;
+
+    /** @brief 個體索引 → 鍵值 */
+    std::vector<double> m_keys;
+};
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef PROBLEM_INSTANCE_H
+#define PROBLEM_INSTANCE_H
+
+#include "Core/Types.h"
+#include "Core/HugePageArena.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class ProblemInstance
+ * @brief 唯讀、可共享的 TSP 實例：城市座標、距離矩陣與近鄰清單
+ * * 以 std::shared_ptr<const ProblemInstance> 傳遞，建構一次即可交給任意數量的求解器與執行緒同時讀取，
+ * 記憶體用量與前置時間不隨並行求解數成長。建立後內容不再改變；近鄰清單在第一次取用時以
+ * std::call_once 建立，之後同樣唯讀。需要修改實例的操作 (例如 GASolver::resolve) 會另建新實例，
+ * 不影響其他持有者。
+ */
+class ProblemInstance {
+public:
+    /** @brief 近鄰清單中每個城市保留的鄰居數 */
+    static constexpr int kNeighborCount = 8;
+
+    /**
+     * @brief 由城市座標建立實例 (預計算距離矩陣)
+     * @param cities 城市座標列表
+     * @param renumber 是否依 Hilbert 曲線順序重新編號城市 (內部編號 → 輸入索引的對照存於 cityOrder())
+     * @param threads 距離矩陣建構使用的執行緒數 (0 代表硬體核心數)
+     * @param hugePages 距離矩陣是否使用透明大分頁 (見 HugePageArena::advise)
+     * @return 共享的唯讀實例
+     */
+    static std::shared_ptr<const ProblemInstance> create(const std::vector<City>& cities, bool renumber = false,
+                                                         unsigned int threads = 0, bool hugePages = false);
+
+    /**
+     * @brief 以已建好的資料建立實例 (接管各容器，不重新計算)
+     * @param cities 依內部編號排列的城市
+     * @param cityOrder 內部編號 → 輸入索引 (未重新編號時為空)
+     * @param distances 扁平化距離矩陣 ($n \times n$)
+     * @param neighbors 近鄰清單 (空代表第一次取用時再建立)
+     * @param hugePages 距離矩陣是否使用透明大分頁 (呼叫端應在寫入矩陣前先行提示，此處只記錄結果)
+     * @return 共享的唯讀實例
+     * @throw std::runtime_error 矩陣或對照表大小與城市數不符
+     */
+    static std::shared_ptr<const ProblemInstance> adopt(std::vector<City> cities, std::vector<int> cityOrder,
+                                                        std::vector<double> distances,
+                                                        std::vector<std::vector<int>> neighbors = {},
+                                                        bool hugePages = false);
+
+    /**
+     * @brief 取出實例的距離矩陣供呼叫端修改
+     * * 呼叫端持有唯一的參照時直接搬移矩陣 ($O(1)$)，之後該實例的 distances() 為空，只可再讀取其他欄位；
+     * 實例仍與其他持有者共享時複製一份，其他持有者看到的實例不變。
+     * @param instance 實例
+     * @return 距離矩陣
+     */
+    static std::vector<double> takeDistances(const std::shared_ptr<const ProblemInstance>& instance);
+
+    ProblemInstance(const ProblemInstance&) = delete;
+    ProblemInstance& operator=(const ProblemInstance&) = delete;
+
+    /** @brief 城市數量 $n$ */
+    int cityCount() const { return static_cast<int>(m_cities.size()); }
+
+    /** @brief 依內部編號排列的城市 (重新編號時 id 為內部編號) */
+    const std::vector<City>& cities() const { return m_cities; }
+
+    /** @brief 內部編號 → 輸入索引的對照表 (未重新編號時為空) */
+    const std::vector<int>& cityOrder() const { return m_cityOrder; }
+
+    /** @brief 扁平化距離矩陣 ($n \times n$，以內部編號索引) */
+    const std::vector<double>& distances() const { return m_distances; }
+
+    /** @brief 距離矩陣的分頁方式 */
+    PageBacking distanceBacking() const { return m_distanceBacking; }
+
+    /**
+     * @brief 各城市的 kNeighborCount 近鄰清單 (第一次呼叫時建立，$O(n^2 \log k)$，可多執行緒同時呼叫)
+     */
+    const std::vector<std::vector<int>>& neighbors() const;
+
+    /** @brief 近鄰清單是否已經建立 */
+    bool hasNeighbors() const { return m_neighborsReady.load(std::memory_order_acquire); }
+
+    /**
+     * @brief 依輸入索引排列的城市列表 (撤銷重新編號)
+     */
+    std::vector<City> originalCities() const;
+
+private:
+    ProblemInstance(std::vector<City> cities, std::vector<int> cityOrder, std::vector<double> distances,
+                    std::vector<std::vector<int>> neighbors, bool hugePages);
+
+    std::vector<City> m_cities;
+    std::vector<int> m_cityOrder;
+    std::vector<double> m_distances;
+    PageBacking m_distanceBacking = PageBacking::Regular;
+
+    // 延遲建立的近鄰清單 (建立完成後唯讀)
+    mutable std::once_flag m_neighborsOnce;
+    mutable std::atomic<bool> m_neighborsReady{false};
+    mutable std::vector<std::vector<int>> m_neighbors;
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef RANDOM_STREAM_H
+#define RANDOM_STREAM_H
+
+#include <cstdint>
+
+/**
+ * @class RandomStream
+ * @brief 批次補充的執行緒區域隨機數串流 (xoshiro256** x 4 lanes)
+ * * 演化迴圈中每個子代都要抽取數個亂數 (錦標賽、OX 切點、突變)，逐次建立
+ * `std::uniform_*_distribution` 並推進 mt19937 的成本在剖析中清晰可見。本類別改為：
+ * - 四條獨立的 xoshiro256** 狀態以 SoA 排列，一次補充整個緩衝區 (kBufferSize 個 64-bit 亂數)，
+ *   內層迴圈只有位移、加法與 XOR (乘以 5、9 可化為位移加法)，編譯器可直接向量化；
+ * - 抽取時只是讀取緩衝區的下一個元素；
+ * - 有界整數使用 Lemire 的乘法-位移法，只在極少數需要拒絕取樣時才做一次取餘數。
+ * 每個執行緒各自持有一個實例，不需同步。
+ */
+class RandomStream {
+public:
+    /** @brief 平行推進的獨立狀態數 (對應 AVX2 的 4 個 64-bit 通道) */
+    static constexpr int kLanes = 4;
+
+    /** @brief 每次補充的亂數個數 (2 KB，常駐 L1) */
+    static constexpr int kBufferSize = 256;
+
+    /**
+     * @brief 建構子
+     * @param seed 種子 (以 SplitMix64 擴展為各通道的狀態)
+     */
+    explicit RandomStream(std::uint64_t seed);
+
+    /**
+     * @brief 重設種子並捨棄緩衝區中尚未使用的亂數
+     * @param seed 種子
+     */
+    void seed(std::uint64_t seed);
+
+    /**
+     * @brief 取得下一個 64-bit 均勻亂數
+     */
+    std::uint64_t next() {
+        if (m_position == kBufferSize) refill();
+        return m_buffer[m_position++];
+    }
+
+    /**
+     * @brief 產生 $[0, range)$ 內的均勻整數 (Lemire 無偏差有界抽樣)
+     * * 以 32-bit 亂數乘上 range 取高位；低位落在拒絕區間 (機率 < range / $2^{32}$) 時才重抽。
+     * @param range 區間大小 (> 0)
+     */
+    std::uint32_t bounded(std::uint32_t range) {
+        std::uint64_t product = (next() >> 32) * range;
+        std::uint32_t low = static_cast<std::uint32_t>(product);
+        if (low < range) {
+            std::uint32_t threshold = (0u - range) % range; // $2^{32} \bmod range$
+            while (low < threshold) {
+                product = (next() >> 32) * range;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    /**
+     * @brief 產生 $[0, 1)$ 內的均勻浮點數 (取高 53 位元作為尾數)
+     */
+    double uniform() {
+        return static_cast<double>(next() >> 11) * 0x1.0p-53;
+    }
+
+private:
+    /**
+     * @brief 以四條 xoshiro256** 狀態重新填滿緩衝區
+     */
+    void refill();
+
+    /** @brief 已產生、尚未使用的亂數 */
+    alignas(64) std::uint64_t m_buffer[kBufferSize];
+
+    /** @brief xoshiro256** 狀態 (SoA：m_state[k][lane] 為第 lane 條狀態的第 k 個字組) */
+    alignas(32) std::uint64_t m_state[4][kLanes];
+
+    /** @brief 下一個要讀取的緩衝區位置 */
+    int m_position = kBufferSize;
+};
+
+#endif
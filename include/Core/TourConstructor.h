@@ -0,0 +1,80 @@
+#ifndef TOUR_CONSTRUCTOR_H
+#define TOUR_CONSTRUCTOR_H
+
+#include "Core/Types.h"
+#include <vector>
+
+/**
+ * @class TourConstructor
+ * @brief 建構式啟發法 (Constructive Heuristics) 工具組
+ * * 隨機排列的初始路徑通常比最優解長約 10 倍，使得演化前數千代都在做「粗整理」。
+ * 本類別提供三種隨機化的建構法，讓初始族群直接從約 20% 誤差附近起跑：
+ * - 最近鄰居法 (Nearest Neighbor)
+ * - 貪婪邊法 (Greedy Edge)
+ * - Hilbert 空間填充曲線 (Space-Filling Curve)
+ * * 所有方法皆只讀取共享資料並使用執行緒區域的隨機數引擎，可安全地平行呼叫。
+ */
+class TourConstructor {
+public:
+    /**
+     * @brief 隨機化最近鄰居法，時間複雜度 $O(n^2)$
+     * * 從隨機城市出發，每一步前往最近的未拜訪城市；
+     * 以機率 randomness 改走「第二近」的城市，讓每次建構的路徑不同。
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量
+     * @param randomness 選擇次近城市的機率
+     * @return 城市存取順序
+     */
+    static std::vector<int> nearestNeighbor(const std::vector<double>& distMatrix, int n,
+                                            double randomness = 0.1);
+
+    /**
+     * @brief 以近鄰清單加速的隨機化最近鄰居法，一般情況下接近 $O(nk)$
+     * * 每一步只掃描目前城市的近鄰清單 (已依距離排序)，取前兩個未拜訪者作為最近與次近；
+     * 清單內全數已拜訪時才退回整列掃描。清單內只剩一個未拜訪城市時不做次近選擇。
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量
+     * @param candidates 各城市的近鄰清單 (由 buildCandidateLists 產生)
+     * @param randomness 選擇次近城市的機率
+     * @return 城市存取順序
+     */
+    static std::vector<int> nearestNeighbor(const std::vector<double>& distMatrix, int n,
+                                            const std::vector<std::vector<int>>& candidates,
+                                            double randomness = 0.1);
+
+    /**
+     * @brief 隨機化貪婪邊法
+     * * 依邊長由短到長加入候選邊 (度數不超過 2 且不形成子迴路)，
+     * 最後以「最近端點」將剩餘片段串接成完整迴路。
+     * 候選邊僅取自各城市的 k 近鄰清單，並對邊長乘上 $(1 \pm noise)$ 的擾動以產生多樣性。
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量
+     * @param candidates 各城市的近鄰清單 (由 buildCandidateLists 產生)
+     * @param noise 邊長擾動幅度
+     * @return 城市存取順序
+     */
+    static std::vector<int> greedyEdge(const std::vector<double>& distMatrix, int n,
+                                       const std::vector<std::vector<int>>& candidates,
+                                       double noise = 0.05);
+
+    /**
+     * @brief 隨機化 Hilbert 空間填充曲線，時間複雜度 $O(n \log n)$
+     * * 依城市在 Hilbert 曲線上的位置排序；每次建構前對座標做隨機旋轉，
+     * 使曲線以不同角度掃過平面，產生不同的路徑。
+     * @param cities 城市座標列表
+     * @return 城市存取順序
+     */
+    static std::vector<int> spaceFillingCurve(const std::vector<City>& cities);
+
+    /**
+     * @brief 建立各城市的 k 近鄰清單，時間複雜度 $O(n^2 \log k)$
+     * @param distMatrix 扁平化距離矩陣
+     * @param n 城市數量
+     * @param k 每個城市保留的近鄰數量
+     * @return candidates[i] 為城市 i 依距離遞增排序的近鄰編號
+     */
+    static std::vector<std::vector<int>> buildCandidateLists(const std::vector<double>& distMatrix,
+                                                              int n, int k);
+};
+
+#endif
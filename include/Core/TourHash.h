@@ -0,0 +1,53 @@
+#ifndef TOUR_HASH_H
+#define TOUR_HASH_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class TourHash
+ * @brief 旋轉與方向不變的路徑雜湊 (Zobrist-style Edge Hash)
+ * * 將封閉路徑視為「無向邊的集合」，雜湊值定義為所有邊金鑰的 XOR。
+ * 因此同一條迴路不論從哪個城市出發 (旋轉) 或反向走訪 (方向)，雜湊值皆相同。
+ * * 邊金鑰由 splitmix64 對 (min, max) 端點即時混合產生，不需 $O(n^2)$ 的金鑰表；
+ * 交換突變與 2-Opt 只會改變常數條邊，可用 $O(1)$ 的 XOR 增量更新。
+ * * 約定：雜湊值 0 代表「尚未計算」，任何改動路徑的程式碼必須同步更新或將其歸零。
+ */
+class TourHash {
+public:
+    /**
+     * @brief 計算無向邊 (a, b) 的 64-bit 金鑰
+     * @param a 城市 A 的編號
+     * @param b 城市 B 的編號
+     * @return 與端點順序無關的邊金鑰
+     */
+    static std::uint64_t edgeKey(int a, int b);
+
+    /**
+     * @brief 從頭計算整條封閉路徑的雜湊值，時間複雜度 $O(n)$
+     * @param path 城市存取順序
+     * @return 路徑雜湊值 (保證非 0)
+     */
+    static std::uint64_t compute(const std::vector<int>& path);
+
+    /**
+     * @brief 交換路徑中兩個位置的城市，並以 $O(1)$ 增量更新雜湊值
+     * * 僅重新計算與位置 i、j 相鄰的 (最多四條) 邊，相鄰或重疊的邊會自動去重。
+     * @param path 欲修改的路徑
+     * @param i 位置 i
+     * @param j 位置 j
+     * @param hash 路徑目前的雜湊值；若為 0 (未知) 則維持為 0
+     */
+    static void swapCities(std::vector<int>& path, int i, int j, std::uint64_t& hash);
+
+    /**
+     * @brief 計算 2-Opt 移動的雜湊增量
+     * * 移除邊 (a, b)、(c, d) 並加入邊 (a, c)、(b, d)，新雜湊值 = 舊雜湊值 XOR 增量。
+     * 子路徑翻轉本身不改變其內部的無向邊集合，因此增量與翻轉長度無關。
+     */
+    static std::uint64_t twoOptDelta(int a, int b, int c, int d) {
+        return edgeKey(a, b) ^ edgeKey(c, d) ^ edgeKey(a, c) ^ edgeKey(b, d);
+    }
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef TWO_LEVEL_LIST_H
+#define TWO_LEVEL_LIST_H
+
+#include <vector>
+
+/**
+ * @class TwoLevelList
+ * @brief 兩層式路徑表示法 (Two-Level List with Segment Reversal Bits)
+ * * 以 std::vector<int> 表示路徑時，2-Opt 每次翻轉子路徑都需要 $O(n)$ 的 std::reverse。
+ * 本類別將路徑切成約 $\sqrt{n}$ 個區段 (Segment)，每個區段帶有一個「反轉位元」：
+ * - 上層：區段的走訪順序 (m_order) 與每個區段的起始序號；
+ * - 下層：各區段內的城市陣列，反轉位元為真時以相反方向解讀。
+ * * 翻轉一段路徑只需在兩端各切開一次區段 ($O(\sqrt{n})$)，再將中間區段的順序倒置並切換
+ * 反轉位元 ($O(\sqrt{n})$)。區段數量過多時整體重建，攤銷後每次操作仍為 $O(\sqrt{n})$。
+ * * next / prev / between / sequence 皆為 $O(1)$ (區段內查表)，優於完整雙向鏈結串列的實作常數。
+ */
+class TwoLevelList {
+public:
+    /**
+     * @brief 由一般的路徑序列建立兩層式表示
+     * @param path 城市存取順序 (0 ~ n-1 的置換)
+     */
+    explicit TwoLevelList(const std::vector<int>& path);
+
+    /** @brief 城市總數 */
+    int size() const { return m_n; }
+
+    /** @brief 沿目前走訪方向，城市 c 的下一個城市 */
+    int next(int c) const;
+
+    /** @brief 沿目前走訪方向，城市 c 的前一個城市 */
+    int prev(int c) const;
+
+    /** @brief 城市 c 在路徑中的序號 (0 ~ n-1) */
+    int sequence(int c) const;
+
+    /**
+     * @brief 判斷沿走訪方向從 a 出發到 c 的路上是否會經過 b (含端點)
+     */
+    bool between(int a, int b, int c) const;
+
+    /**
+     * @brief 翻轉沿走訪方向從 a 到 b 的子路徑 (含端點)
+     * * 若該子路徑繞過序列尾端，改為翻轉其補集；對封閉迴路而言兩者等價 (僅整體方向不同)。
+     * @param a 子路徑起點
+     * @param b 子路徑終點
+     */
+    void reverse(int a, int b);
+
+    /**
+     * @brief 轉回一般的路徑序列 (供寫回 Individual::path)
+     */
+    std::vector<int> toPath() const;
+
+private:
+    /**
+     * @struct Segment
+     * @brief 下層區段：連續的城市陣列與反轉位元
+     */
+    struct Segment {
+        std::vector<int> cities; /**< 區段內城市 (原始儲存順序) */
+        bool reversed = false;   /**< 為真時以相反方向解讀 cities */
+    };
+
+    /** @brief 以約 $\sqrt{n}$ 的區段大小重建整個結構 */
+    void rebuild(const std::vector<int>& path);
+
+    /** @brief 確保序號 pos 的城市位於某個區段的開頭 (必要時切開區段) */
+    void splitAt(int pos);
+
+    /** @brief 找出包含序號 pos 的區段在 m_order 中的位置 (二分搜尋) */
+    int rankAt(int pos) const;
+
+    /** @brief 重新計算 m_order[from..to] 的區段排名與起始序號 */
+    void refreshRanks(int from, int to);
+
+    /** @brief 翻轉序號區間 [i, j] (不繞回) */
+    void reverseRange(int i, int j);
+
+    /** @brief 區段依走訪方向的第一個 / 最後一個城市 */
+    int firstOf(int seg) const;
+    int lastOf(int seg) const;
+
+    int m_n = 0;
+    int m_targetSize = 1;                /**< 重建時的區段大小 (約 $\sqrt{n}$) */
+
+    std::vector<Segment> m_segments;     /**< 所有區段 (以區段 ID 索引) */
+    std::vector<int> m_order;            /**< 上層：區段 ID 的走訪順序 */
+    std::vector<int> m_rank;             /**< 區段 ID → 在 m_order 中的位置 */
+    std::vector<int> m_start;            /**< m_order 位置 → 該區段第一個城市的序號 */
+
+    std::vector<int> m_segOf;            /**< 城市 → 所屬區段 ID */
+    std::vector<int> m_offset;           /**< 城市 → 在區段 cities 中的原始索引 */
+};
+
+#endif
@@ -2,9 +2,11 @@
 #define TYPES_H
 
 #include <vector>
+#include <atomic>
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <cstdint>
 
 /**
  * @struct City
@@ -17,6 +19,18 @@ struct City {
     double y;     /**< Y 軸座標 */
 };
 
+/**
+ * @struct InstanceDelta
+ * @brief 動態實例的變更描述 (供 GASolver::resolve 增量重新求解)
+ * * 所有索引皆為「變更前」實例中的城市索引。套用後的新編號規則：
+ * 保留的城市依原順序緊密重新編號，新增的城市依序接在最後。
+ */
+struct InstanceDelta {
+    std::vector<City> added;   /**< 新增的城市 (id 欄位會被忽略並重新指派) */
+    std::vector<int> removed;  /**< 移除的城市索引 */
+    std::vector<City> moved;   /**< 座標變更的城市 (id 為城市索引，x / y 為新座標) */
+};
+
 /**
  * @struct Individual
  * @brief 遺傳演算法中的個體 (染色體)
@@ -27,11 +41,12 @@ struct Individual {
     std::vector<int> path; /**< 城市 ID 的排列序列 */
     double distance;       /**< 該路徑的總歐幾里得距離 */
     double fitness;        /**< 適應度評分 (通常定義為 $1/distance$) */
+    std::uint64_t hash;    /**< 旋轉與方向不變的路徑雜湊 (TourHash)，0 代表尚未計算 */
 
     /**
      * @brief 預設建構子
      */
-    Individual() : distance(0.0), fitness(0.0) {}
+    Individual() : distance(0.0), fitness(0.0), hash(0) {}
 
     /**
      * @brief 排序運算子重載
@@ -45,6 +60,25 @@ struct Individual {
     }
 };
 
+/**
+ * @enum ReplacementPolicy
+ * @brief 穩態演化模式下，子代取代族群成員的策略
+ */
+enum class ReplacementPolicy {
+    Worst,           /**< 取代族群中最差 (距離最長) 的個體 */
+    TournamentLoser  /**< 取代隨機錦標賽中的落敗者，保留較多多樣性 */
+};
+
+/**
+ * @enum SelectionMode
+ * @brief 世代 / 管線化模式的親代選擇策略
+ */
+enum class SelectionMode {
+    Tournament,         /**< 錦標賽選擇：隨機抽選 tournamentSize 個，取最佳者 */
+    Rank,               /**< 線性排名選擇：第 r 名 (0 為最佳) 被選中的機率正比於 $P - r$ */
+    StochasticUniversal /**< 隨機普遍抽樣 (SUS)：以視窗化適應度為權重、等間距指標一次抽出整代的親代 */
+};
+
 /**
  * @struct GAConfig
  * @brief 遺傳演算法參數配置結構
@@ -61,11 +95,54 @@ struct GAConfig {
     int eliteCount;         /**< 精英保留人數 (建議 2-5% $P$) */
     bool useParallel;       /**< 是否啟用 std::async 多執行緒評估 */
 
+    SelectionMode selectionMode = SelectionMode::Tournament; /**< 親代選擇策略 (穩態模式固定使用錦標賽) */
+
+    bool steadyState = false;   /**< 是否改用穩態 (Steady-State) 取代模式，取代每代全族群排序 */
+    ReplacementPolicy replacement = ReplacementPolicy::Worst; /**< 穩態模式下的取代策略 */
+    int steadyStateBatchSize = 128; /**< 穩態模式每批產生並平行評估的子代數量 */
+
+    bool pipelined = false;         /**< 世代模式改用管線化執行：繁衍、評估與局部搜尋以區塊為單位融合成平行任務 */
+    int pipelineChunkSize = 64;     /**< 管線化模式每個任務處理的子代數量 */
+
+    bool useFitnessCache = false;   /**< 是否以路徑雜湊快取適應度，跳過重複路徑的 $O(n)$ 評估 */
+    bool rejectDuplicates = false;  /**< 是否拒絕與族群中既有路徑完全相同的子代，以維持多樣性 (NUMA 感知的平行繁衍只檢查精英與同一批次) */
+
+    // --- 初始族群組成比例 (預設皆為 0，需明確啟用；其餘為隨機排列) ---
+    double initNearestNeighborRatio = 0.0; /**< 以隨機化最近鄰居法建構的比例 */
+    int initNearestNeighborLimit = 32;     /**< 最近鄰居法建構的路徑數上限 (P ≈ 4n 時僅依比例換算會使初始化隨 n 三次方成長) */
+    double initGreedyEdgeRatio = 0.0;      /**< 以隨機化貪婪邊法建構的比例 */
+    double initSpaceFillingRatio = 0.0;    /**< 以隨機旋轉 Hilbert 曲線建構的比例 */
+
+    int neighborListThreshold = 1000; /**< 城市數達此門檻時，2-Opt 改用近鄰清單與兩層式串列 (TwoLevelList) */
+    bool numaAware = false;           /**< 啟用 NUMA 感知配置：各節點複製距離矩陣、評估與初始化執行緒綁定 CPU */
+    bool useHugePages = false;        /**< 大型緩衝區改用 2 MB 大分頁：距離矩陣 (含 NUMA 複本) 提示透明大分頁，排名鍵與 SUS 親代池達 2 MB 時改由 HugePageArena 配置 */
+
+    // --- 執行資源與 Memetic 強度 (可由 AutoTuner 校準) ---
+    unsigned int threadCount = 0;     /**< 平行批次任務數 (0 代表使用 hardware_concurrency) */
+    int parallelThreshold = 64;       /**< 族群 (或批次) 大小超過此值才啟用平行評估 */
+    int localSearchCount = 1;         /**< 每代執行 2-Opt 的個體數 (最佳者 + 隨機抽選的 localSearchCount-1 個) */
+    int parallelPolishThreshold = 5000; /**< 城市數達此門檻 (且 useParallel) 時，最佳個體的 2-Opt 改為區段平行執行 */
+
+    // --- 最佳性下界 (Held-Karp) ---
+    bool computeLowerBound = false;   /**< 是否在背景平行計算 Held-Karp 1-Tree 下界，以回報可證明的最佳性差距 */
+    double targetGap = 0.0;           /**< 差距 (UB - LB) / LB 低於此值時提前結束演化 (> 0 時自動啟用下界計算) */
+    bool renumberCities = false;      /**< 建表前依 Hilbert 曲線順序重新編號城市，提升查表的快取區域性 (輸出時自動換回原編號) */
+    int exactThreshold = 0;           /**< 城市數不超過此值時改用 ExactSolver 的位元遮罩 DP 直接求最佳解 (0 代表停用，generateDefault 設為 17) */
+    double timeLimitSeconds = 0.0;    /**< 求解時間上限 (秒，自 solve() / resolve() 呼叫起算，0 代表不限)，超過後於當代結束時停止 */
+    const std::atomic<bool>* stopFlag = nullptr; /**< 外部取消旗標 (可為空)：被設為 true 後於當代結束時停止並回傳目前最佳解 */
+
     /** * @brief 演化進度回報回呼函式
      * 格式：void(當前代數, 當前最佳距離)
      */
     std::function<void(int, double)> onGenerationComplete = nullptr;
 
+    /**
+     * @brief 歷史最佳解改善時的回呼函式
+     * 格式：void(當前代數, 最佳個體 (以輸入城市索引表示))。於求解執行緒上呼叫，每代至多一次，
+     * 第一代必定呼叫 (回報起始最佳解)。
+     */
+    std::function<void(int, const Individual&)> onBestImproved = nullptr;
+
     /**
      * @brief 靜態工廠方法：根據城市數量自動生成優化參數
      * * 實踐「參數隨規模動態調整」的研發思維。
@@ -95,6 +172,10 @@ struct GAConfig {
         config.eliteCount = std::max(1, static_cast<int>(0.03 * config.populationSize));
         
         config.useParallel = true;
+
+        // 精確解分派：DP 時間約隨 n 每加一倍增 (單核 n = 17 約 60 ms、n = 18 約 140 ms，dp 表 4 MB / 9 MB)；
+        // n ≤ 17 時比上述預設參數的演化更快且保證最佳，n ≥ 18 起 DP 反而較慢
+        config.exactThreshold = 17;
         return config;
     }
 };
@@ -2,7 +2,10 @@
 #define UTILS_H
 
 #include "Core/Types.h"
+#include "Core/RandomStream.h"
+#include <cstdint>
 #include <random>
+#include <utility>
 
 /**
  * @class Utils
@@ -22,14 +25,49 @@ public:
      */
     static std::vector<City> generateRandomCities(int n, double maxX, double maxY);
 
+    /**
+     * @brief 產生群聚分佈的城市資料
+     * * 先均勻撒下 clusters 個中心，每個城市隨機歸屬一個中心並以常態分佈偏移 (超出邊界者截斷)。
+     * 模擬真實物流資料中「城市 / 商圈」的密度不均，2-Opt 與近鄰清單在此類實例上的行為與均勻分佈差異很大。
+     * @param n 欲產生的城市數量
+     * @param clusters 群聚中心數量
+     * @param maxX X 軸最大邊界
+     * @param maxY Y 軸最大邊界
+     * @param spread 常態分佈的標準差 (相對於 min(maxX, maxY) 的比例)，預設為 0.02
+     * @return 群聚分佈的城市向量集合
+     */
+    static std::vector<City> generateClusteredCities(int n, int clusters, double maxX, double maxY,
+                                                     double spread = 0.02);
+
+    /**
+     * @brief 產生格點分佈的城市資料
+     * * 城市依列優先順序放在 $\lceil \sqrt{n} \rceil$ 欄的等距格點上 (最後一列可能不滿)，
+     * 可加上均勻抖動。無抖動時存在大量等長的邊與等價最佳解，是平手處理與退化情況的壓力測試。
+     * @param n 欲產生的城市數量
+     * @param maxX X 軸最大邊界
+     * @param maxY Y 軸最大邊界
+     * @param jitter 每個座標的最大抖動量 (相對於格距的比例)，預設為 0 (完全規則)
+     * @return 格點分佈的城市向量集合
+     */
+    static std::vector<City> generateGridCities(int n, double maxX, double maxY, double jitter = 0.0);
+
     /**
      * @brief 預計算距離矩陣
      * * 為了消除演化過程中重複的三角函數與開根號運算，預先計算所有城市間的歐幾里得距離。
      * 採用扁平化一維向量存儲以提升記憶體存取連續性 (Spatial Locality)，時間複雜度為 $O(n^2)$。
+     * * 建構方式：座標轉為 SoA 陣列後，以 kDistanceTile x kDistanceTile 的磚塊只計算上三角
+     * (每個對稱配對只開一次根號，內層迴圈無分支、可向量化)，再以第二階段轉置填入下三角。
+     * 每個執行緒負責連續的磚塊列，兩階段都只寫入自己的列，不需同步寫入，工作量也均勻 (上三角遞減、下三角遞增)。
      * @param cities 城市座標列表
+     * @param threads 建構執行緒數 (0 代表 hardware_concurrency，1 代表序列)
+     * @param hugePages 是否在首次寫入前以 HugePageArena::advise() 提示矩陣使用透明大分頁
      * @return 扁平化的距離矩陣向量
      */
-    static std::vector<double> precomputeDistanceMatrix(const std::vector<City>& cities);
+    static std::vector<double> precomputeDistanceMatrix(const std::vector<City>& cities, unsigned int threads = 0,
+                                                        bool hugePages = false);
+
+    /** @brief 距離矩陣建構的磚塊邊長 (64 x 64 個 double = 32 KB，約等於 L1 資料快取) */
+    static constexpr int kDistanceTile = 64;
 
     /**
      * @brief 獲取預先計算好的距離 (查表優化)
@@ -43,36 +81,80 @@ public:
      */
     static double getDistance(int cityA, int cityB, const std::vector<double>& distMatrix, int n);
 
+    /**
+     * @brief 計算城市在 Hilbert 空間填充曲線上的走訪順序
+     * * 將座標正規化至 $2^{16} \times 2^{16}$ 的網格後計算 Hilbert 索引並排序，
+     * 平面上相近的城市在回傳序列中也會相近。時間複雜度 $O(n \log n)$。
+     * @param cities 城市座標列表
+     * @return 依 Hilbert 索引遞增排列的城市位置 (cities 的索引)
+     */
+    static std::vector<int> hilbertOrder(const std::vector<City>& cities);
+
     /**
      * @brief 產生指定範圍內的隨機整數
+     * * 自執行緒區域的 RandomStream 緩衝區取值並以 Lemire 法映射至區間，不建立分佈物件、不做除法。
      * @param min 最小值 (包含)
      * @param max 最大值 (包含)
      * @return 區間 $[min, max]$ 內的隨機整數
      */
-    static int getRandomInt(int min, int max);
+    static int getRandomInt(int min, int max) {
+        std::uint32_t span = static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min + 1);
+        if (span == 0) return static_cast<int>(static_cast<std::uint32_t>(g_stream.next() >> 32)); // 整個 int 範圍
+        return static_cast<int>(static_cast<std::int64_t>(min) + g_stream.bounded(span));
+    }
 
     /**
      * @brief 產生指定範圍內的隨機浮點數
      * @param min 最小值，預設為 0.0
      * @param max 最大值，預設為 1.0
-     * @return 區間 $[min, max]$ 內的隨機浮點數
+     * @return 區間 $[min, max)$ 內的隨機浮點數
+     */
+    static double getRandomDouble(double min = 0.0, double max = 1.0) {
+        return min + (max - min) * g_stream.uniform();
+    }
+
+    /**
+     * @brief 以 Fisher-Yates 演算法隨機打亂區間 (使用 getRandomInt 的批次亂數)
+     * * 演化迴圈內的打亂 (親代配對、隨機初始路徑) 使用此版本；std::shuffle 搭配 getGenerator() 仍可使用。
+     * @param first 區間起點
+     * @param last 區間終點
      */
-    static double getRandomDouble(double min = 0.0, double max = 1.0);
+    template <typename RandomIt>
+    static void shuffle(RandomIt first, RandomIt last) {
+        auto n = last - first;
+        for (decltype(n) i = n - 1; i > 0; --i) {
+            std::swap(first[i], first[g_stream.bounded(static_cast<std::uint32_t>(i + 1))]);
+        }
+    }
 
     /**
-     * @brief 獲取全域靜態隨機數引擎的引用
-     * * 確保整個演化流程共用同一個實例，避免因短時間內重覆建立引擎導致隨機性失效。
+     * @brief 獲取當前執行緒專屬隨機數引擎的引用
+     * * 每個執行緒各自持有一個實例 (thread_local)，同一執行緒內的演化流程共用引擎，
+     * 多個求解器同時在不同執行緒上運作時也不會產生資料競爭 (Data Race)。
      * @return std::mt19937 引擎引用
      */
     static std::mt19937& getGenerator() {
         return g_gen;
     }
 
+    /**
+     * @brief 以指定種子重設當前執行緒的隨機數引擎與批次亂數串流
+     * * 只影響呼叫端執行緒；關閉 useParallel 的求解在同一執行緒上執行，因此可完全重現。
+     * @param value 種子
+     */
+    static void seed(unsigned int value) {
+        g_gen.seed(value);
+        g_stream.seed(value);
+    }
+
 private:
-    /** * @brief 靜態隨機數引擎 (Mersenne Twister)
+    /** * @brief 執行緒區域隨機數引擎 (Mersenne Twister)
      * 具備極長的隨機週期，適合用於科學計算與演算法模擬。
      */
-    static std::mt19937 g_gen;
+    static thread_local std::mt19937 g_gen;
+
+    /** @brief 執行緒區域批次亂數串流 (getRandomInt / getRandomDouble / shuffle 的來源) */
+    static thread_local RandomStream g_stream;
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef TSPLIB_PARSER_H
 #define TSPLIB_PARSER_H
 
+#include <istream>
 #include <string>
 #include <vector>
 #include "Core/Types.h"
@@ -22,6 +23,22 @@ public:
      * @throw std::runtime_cast 若檔案無法開啟或格式不符合標準時可能拋出異常
      */
     static std::vector<City> parse(const std::string& filePath);
+
+    /**
+     * @brief 解析記憶體中的 TSPLIB 文字內容 (例如經由網路收到的實例)
+     * @param content TSPLIB 格式的完整文字
+     * @return 轉換後的城市資料向量
+     * @throw std::runtime_error 找不到任何座標時拋出
+     */
+    static std::vector<City> parseString(const std::string& content);
+
+private:
+    /**
+     * @brief 由輸入串流解析 NODE_COORD_SECTION
+     * @param in 輸入串流
+     * @param source 錯誤訊息中使用的來源描述
+     */
+    static std::vector<City> parseStream(std::istream& in, const std::string& source);
 };
 
 #endif
\ No newline at end of file
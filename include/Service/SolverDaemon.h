@@ -0,0 +1,176 @@
+#ifndef SOLVER_DAEMON_H
+#define SOLVER_DAEMON_H
+
+#include "Core/Types.h"
+#include "Core/BatchSolver.h"
+#include "Core/ProblemInstance.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct DaemonConfig
+ * @brief 求解服務的監聽位址與資源設定
+ */
+struct DaemonConfig {
+    std::string unixPath;            /**< 非空時監聽此路徑的 Unix-domain socket */
+    int tcpPort = -1;                /**< >= 0 時監聽 127.0.0.1 的 TCP 連接埠 (0 代表由系統指定，以 port() 查詢) */
+    unsigned int workerCount = 0;    /**< 常駐求解執行緒數 (0 代表 hardware_concurrency) */
+    std::size_t cacheCapacity = 16;  /**< 實例 LRU 快取保留的實例數 */
+    double defaultTimeLimit = 30.0;  /**< 請求未指定 time 與 generations 時套用的時間預算 (秒，0 代表沿用 makeConfig 的代數) */
+
+    /** @brief 依城市數量產生 GA 參數的工廠函式 (useParallel 會被強制關閉) */
+    std::function<GAConfig(int)> makeConfig = &GAConfig::generateDefault;
+};
+
+/**
+ * @class SolverDaemon
+ * @brief 常駐求解服務：以本機 socket 接收求解請求，串流回傳改善中的路徑與最終結果
+ * * 每個請求只需付出求解本身的時間：工作執行緒 (BatchSolver 執行緒池) 常駐，
+ * 最近使用的實例 (座標、距離矩陣、近鄰清單) 以 LRU 快取保留，重複的實例不再解析與建表。
+ * 每個連線一次處理一個請求；多個連線的請求在執行緒池上同時求解 (每個核心一個求解)。
+ *
+ * 行協定 (每行以 '\n' 結尾)：
+ * - 請求：`SOLVE [format=coords|tsplib] [time=<秒>] [seed=<整數>] [generations=<代數>] [population=<族群>] [stream=0|1]
+ *   [publish=<名稱>]`，其後為實例內容，以單獨一行 `END` 結束。coords 格式每行一個城市 `x y`；tsplib 格式為完整的 TSPLIB 文字。
+ *   指定 publish 時，改善中的路徑同時發佈到該名稱的共享記憶體區段 (見 TourPublisher)，
+ *   區段在求解結束後保留 (最後一筆標記為最終結果)，由讀取端以 TourReader::remove() 清理。
+ * - 回應：`ACCEPTED <城市數> cached|built`，接著每次改善一行 `IMPROVED <代數> <秒> <距離> <路徑...>`，
+ *   最後一行 `RESULT <秒> <距離> <路徑...>`；失敗時回應 `ERROR <訊息>`。
+ *   未指定 time 與 generations 時套用 DaemonConfig::defaultTimeLimit；對端斷線時求解於當代結束時中止。
+ *   路徑為請求中城市的 0-based 索引，秒數自收到請求起算。
+ * - 其他指令：`PING` → `PONG`；`STATS` → `STATS requests=<n> hits=<n> misses=<n> instances=<n>`；`QUIT` 關閉連線。
+ * 僅支援 POSIX 平台。
+ */
+class SolverDaemon {
+public:
+    /** @brief 服務統計 */
+    struct Stats {
+        std::uint64_t requests = 0;     /**< 已受理的求解請求數 */
+        std::uint64_t cacheHits = 0;    /**< 實例快取命中次數 */
+        std::uint64_t cacheMisses = 0;  /**< 實例快取未命中 (需解析與建表) 次數 */
+        std::size_t cachedInstances = 0; /**< 目前快取中的實例數 */
+    };
+
+    /**
+     * @brief 建構子：建立常駐工作執行緒池 (尚未開始監聽)
+     * @param config 監聽位址與資源設定
+     */
+    explicit SolverDaemon(const DaemonConfig& config);
+
+    /**
+     * @brief 解構子：停止服務並回收所有執行緒
+     */
+    ~SolverDaemon();
+
+    SolverDaemon(const SolverDaemon&) = delete;
+    SolverDaemon& operator=(const SolverDaemon&) = delete;
+
+    /**
+     * @brief 開始監聽並在背景接受連線
+     * @throw std::runtime_error 未指定位址，或 socket 建立 / 綁定失敗
+     */
+    void start();
+
+    /**
+     * @brief 停止接受連線、關閉既有連線並等待處理中的請求結束
+     * * 進行中的求解會透過各連線的取消旗標在當代結束時中止，不必等到其時間預算或代數上限。
+     */
+    void stop();
+
+    /**
+     * @brief 取得實際綁定的 TCP 連接埠 (未監聽 TCP 時為 -1)
+     */
+    int port() const { return m_boundPort; }
+
+    /**
+     * @brief 取得服務統計
+     */
+    Stats stats() const;
+
+private:
+    /** @brief 連線紀錄：處理執行緒、socket、是否已結束，以及進行中求解的取消旗標 (GAConfig::stopFlag) */
+    struct Connection {
+        int fd = -1;
+        std::thread thread;
+        std::atomic<bool> done{false};
+        std::atomic<bool> cancel{false};
+    };
+
+    /** @brief LRU 快取項目 */
+    struct CacheEntry {
+        std::string key;
+        std::shared_ptr<const ProblemInstance> instance;
+    };
+
+    /**
+     * @brief 接受連線的背景迴圈 (每個監聽 socket 一個執行緒)
+     * @param listenFd 監聽 socket
+     */
+    void acceptLoop(int listenFd);
+
+    /**
+     * @brief 單一連線的請求處理迴圈
+     * @param connection 連線紀錄
+     */
+    void serveConnection(Connection* connection);
+
+    /**
+     * @brief 回收已結束的連線執行緒
+     */
+    void reapConnections();
+
+    /**
+     * @brief 依實例內容查詢快取，未命中時解析並建立實例
+     * @param format 實例格式 ("coords" 或 "tsplib")
+     * @param payload 實例內容
+     * @param cached [out] 是否命中快取
+     * @return 共享實例
+     * @throw std::runtime_error 格式錯誤或無法解析
+     */
+    std::shared_ptr<const ProblemInstance> lookupInstance(const std::string& format, const std::string& payload,
+                                                          bool& cached);
+
+    /** @brief 服務設定 */
+    DaemonConfig m_config;
+
+    /** @brief 常駐求解執行緒池 */
+    BatchSolver m_pool;
+
+    /** @brief 監聽中的 socket */
+    std::vector<int> m_listenFds;
+
+    /** @brief 各監聽 socket 的接受執行緒 */
+    std::vector<std::thread> m_acceptThreads;
+
+    /** @brief 實際綁定的 TCP 連接埠 */
+    int m_boundPort = -1;
+
+    /** @brief 是否正在執行 */
+    std::atomic<bool> m_running{false};
+
+    /** @brief 進行中的連線 (保護於 m_connectionMutex) */
+    std::list<std::unique_ptr<Connection>> m_connections;
+    std::mutex m_connectionMutex;
+
+    /** @brief 實例 LRU 快取：串列前端為最近使用，索引以實例內容為鍵 (指向串列節點內的字串，不另存一份) */
+    std::list<CacheEntry> m_cache;
+    std::unordered_map<std::string_view, std::list<CacheEntry>::iterator> m_cacheIndex;
+    mutable std::mutex m_cacheMutex;
+
+    /** @brief 統計計數 */
+    std::atomic<std::uint64_t> m_requests{0};
+    std::atomic<std::uint64_t> m_cacheHits{0};
+    std::atomic<std::uint64_t> m_cacheMisses{0};
+};
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef TOUR_PUBLISHER_H
+#define TOUR_PUBLISHER_H
+
+#include "Core/Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct TourSnapshot
+ * @brief 共享記憶體中一次發佈的最佳路徑 (複製後的版本)
+ */
+struct TourSnapshot {
+    std::int64_t generation = -1;   /**< 發佈時的代數 */
+    double distance = 0.0;          /**< 路徑長度 */
+    std::uint64_t timestampNs = 0;  /**< 發佈時間 (system_clock，自 epoch 起的奈秒) */
+    bool final = false;             /**< 是否為求解結束後的最終結果 */
+    std::vector<int> path;          /**< 路徑 (輸入城市索引) */
+};
+
+/**
+ * @struct TourView
+ * @brief 直接指向共享記憶體的零複製檢視
+ * * 讀取 path 期間發佈者可能覆寫同一個緩衝區：使用完畢後必須以 TourReader::validate() 確認，
+ * 驗證失敗代表讀到的內容可能不一致，應重新 acquire()。
+ */
+struct TourView {
+    std::int64_t generation = -1;
+    double distance = 0.0;
+    std::uint64_t timestampNs = 0;
+    bool final = false;
+    const std::int32_t* path = nullptr; /**< 指向共享記憶體內的路徑 */
+    std::uint32_t count = 0;            /**< 路徑長度 (城市數) */
+    std::uint32_t slot = 0;             /**< 內部使用：所在緩衝區 */
+    std::uint64_t sequence = 0;         /**< 內部使用：取得時的序號 */
+};
+
+/**
+ * @class TourPublisher
+ * @brief 將求解中的最佳路徑發佈到 POSIX 共享記憶體 (寫入端)
+ * * 區段內含兩個路徑緩衝區 (Double Buffer)，每個緩衝區各有一個 Seqlock 序號：
+ * 寫入端總是寫入「非最新」的緩衝區 (序號先變奇數、寫完再變偶數)，完成後才切換最新索引，
+ * 因此讀取端不需任何鎖，也不會阻擋寫入端；只有在一次讀取期間發生兩次發佈時才需要重試。
+ * 每次發佈的成本為一次 $O(n)$ 的 memcpy，且只在最佳解改善時發生，不影響演化迴圈。
+ * 僅支援 POSIX 平台。
+ */
+class TourPublisher {
+public:
+    /**
+     * @brief 建立 (或覆寫) 共享記憶體區段
+     * @param name 區段名稱 (POSIX shm 名稱，未以 '/' 開頭時自動補上)
+     * @param capacity 可容納的最大城市數
+     * @param unlinkOnClose 解構時是否移除區段名稱 (已開啟的讀取端不受影響)
+     * @throw std::runtime_error 區段建立或映射失敗
+     */
+    TourPublisher(const std::string& name, int capacity, bool unlinkOnClose = true);
+
+    /**
+     * @brief 解構子：解除映射，並依設定移除區段名稱
+     */
+    ~TourPublisher();
+
+    TourPublisher(const TourPublisher&) = delete;
+    TourPublisher& operator=(const TourPublisher&) = delete;
+
+    /**
+     * @brief 發佈一條路徑 (單一寫入端；不可由多個執行緒同時呼叫)
+     * @param generation 代數
+     * @param best 最佳個體 (以輸入城市索引表示)
+     * @param final 是否為最終結果
+     * @throw std::runtime_error 路徑長度超過容量
+     */
+    void publish(std::int64_t generation, const Individual& best, bool final = false);
+
+    /**
+     * @brief 串接到 GAConfig::onBestImproved：每次改善時自動發佈 (保留原本的回呼)
+     * * 發佈者的生命週期必須涵蓋整個求解過程。
+     * @param config 欲掛載的設定
+     */
+    void attach(GAConfig& config);
+
+    /** @brief 正規化後的區段名稱 */
+    const std::string& name() const { return m_name; }
+
+private:
+    std::string m_name;
+    bool m_unlink;
+    int m_fd = -1;
+    void* m_base = nullptr;
+    std::size_t m_size = 0;
+    std::uint32_t m_capacity = 0;
+};
+
+/**
+ * @class TourReader
+ * @brief 讀取 TourPublisher 發佈的最佳路徑 (讀取端，可在任意行程、任意頻率呼叫)
+ * * 以唯讀方式映射區段；讀取不使用鎖、不與寫入端通訊。
+ */
+class TourReader {
+public:
+    /**
+     * @brief 開啟並映射既有的區段
+     * @param name 區段名稱
+     * @throw std::runtime_error 區段不存在、大小不符或格式不相容
+     */
+    explicit TourReader(const std::string& name);
+
+    /**
+     * @brief 解構子：解除映射
+     */
+    ~TourReader();
+
+    TourReader(const TourReader&) = delete;
+    TourReader& operator=(const TourReader&) = delete;
+
+    /**
+     * @brief 發佈次數 (每次發佈加一)，可用於低成本輪詢是否有新路徑
+     */
+    std::uint64_t version() const;
+
+    /**
+     * @brief 取得最新路徑的零複製檢視
+     * @param view [out] 檢視 (path 指向共享記憶體)
+     * @return 尚未發佈任何路徑，或寫入端正在覆寫該緩衝區時回傳 false
+     */
+    bool acquire(TourView& view) const;
+
+    /**
+     * @brief 確認檢視在取得之後未被覆寫
+     * @param view 由 acquire() 取得的檢視
+     * @return true 代表讀到的內容一致
+     */
+    bool validate(const TourView& view) const;
+
+    /**
+     * @brief 複製最新路徑 (內部自動重試直到讀到一致的內容)
+     * @param snapshot [out] 路徑快照
+     * @return 尚未發佈任何路徑 (或寫入端持續覆寫) 時回傳 false
+     */
+    bool read(TourSnapshot& snapshot) const;
+
+    /**
+     * @brief 移除區段名稱 (供未自動移除的發佈者使用後清理)
+     * @param name 區段名稱
+     */
+    static void remove(const std::string& name);
+
+private:
+    const void* m_base = nullptr;
+    std::size_t m_size = 0;
+};
+
+#endif
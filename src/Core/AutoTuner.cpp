@@ -0,0 +1,241 @@
+#include "Core/AutoTuner.h"
+#include "Core/GASolver.h"
+#include "Core/ParallelEvaluator.h"
+#include "Core/Utils.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __unix__
+#include <unistd.h>
+#endif
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// 重複執行 fn 直到累積至少 minSeconds，回傳單次平均耗時 (秒)
+template <typename Fn>
+double timePerCall(Fn&& fn, double minSeconds) {
+    int calls = 0;
+    auto start = Clock::now();
+    do {
+        fn();
+        ++calls;
+    } while (secondsSince(start) < minSeconds);
+    return secondsSince(start) / calls;
+}
+}
+
+int AutoTuner::sizeClass(int cityCount) {
+    int cls = 0;
+    while ((cityCount >> (cls + 1)) > 0) ++cls;
+    return cls;
+}
+
+TuningProfile AutoTuner::calibrate(const std::vector<City>& cities, const GAConfig& base, double budgetSeconds) {
+    const int n = static_cast<int>(cities.size());
+    if (n < 5) {
+        throw std::runtime_error("AutoTuner requires at least 5 cities.");
+    }
+
+    TuningProfile profile;
+    profile.cityCount = n;
+
+    const double evalBudget = budgetSeconds * 0.2;
+    const double burstBudget = budgetSeconds - evalBudget;
+    std::vector<double> distMatrix = Utils::precomputeDistanceMatrix(cities);
+
+    // 評估測試用的隨機族群：總工作量限制在約 2M 次查表以內
+    int probeSize = std::max(256, std::min(4096, 2000000 / n));
+    std::vector<Individual> probe(probeSize);
+    for (auto& ind : probe) {
+        ind.path.resize(n);
+        std::iota(ind.path.begin(), ind.path.end(), 0);
+        Utils::shuffle(ind.path.begin(), ind.path.end());
+    }
+
+    // --- 1. 執行緒數：每秒評估數最高者 (差距 5% 內優先選較少的執行緒) ---
+    unsigned int hw = std::thread::hardware_concurrency();
+    if (hw == 0) hw = 2; // 保底機制
+    std::vector<unsigned int> threadCandidates;
+    for (unsigned int t = 1; t < hw; t *= 2) threadCandidates.push_back(t);
+    threadCandidates.push_back(hw);
+
+    ParallelEvaluator evaluator;
+    double sliceSeconds = evalBudget * 0.5 / threadCandidates.size();
+    double bestThroughput = 0.0;
+    for (unsigned int t : threadCandidates) {
+        evaluator.setThreading(t, 0);
+        double perCall = timePerCall([&]() { evaluator.evaluate(probe, distMatrix, n, t > 1); }, sliceSeconds);
+        double throughput = probeSize / perCall;
+        if (throughput > bestThroughput * 1.05) {
+            bestThroughput = throughput;
+            profile.threadCount = t;
+        }
+    }
+
+    // --- 2. 平行門檻：平行評估開始明顯快於序列評估的最小族群大小 ---
+    if (profile.threadCount <= 1) {
+        profile.parallelThreshold = std::numeric_limits<int>::max();
+    } else {
+        profile.parallelThreshold = probeSize;
+        evaluator.setThreading(profile.threadCount, 0);
+        std::vector<int> sizes;
+        for (int s = 16; s <= probeSize; s *= 2) sizes.push_back(s);
+        double sizeSlice = evalBudget * 0.25 / sizes.size();
+
+        for (int s : sizes) {
+            std::vector<Individual> subset(probe.begin(), probe.begin() + s);
+            double serial = timePerCall([&]() { evaluator.evaluate(subset, distMatrix, n, false); }, sizeSlice);
+            double parallel = timePerCall([&]() { evaluator.evaluate(subset, distMatrix, n, true); }, sizeSlice);
+            if (parallel < serial * 0.95) {
+                profile.parallelThreshold = s - 1;
+                break;
+            }
+        }
+    }
+
+    // --- 3. 演化測試：等時間片比較族群規模與 Memetic 強度 ---
+    std::vector<int> popCandidates = {std::max(50, n), std::max(100, 2 * n), std::max(100, 4 * n)};
+    popCandidates.erase(std::unique(popCandidates.begin(), popCandidates.end()), popCandidates.end());
+    const std::vector<int> lsCandidates = {1, 4, 16};
+
+    double burstSlice = burstBudget / (popCandidates.size() * lsCandidates.size());
+    double bestDistance = std::numeric_limits<double>::max();
+    for (int pop : popCandidates) {
+        for (int ls : lsCandidates) {
+            GAConfig config = base;
+            config.cityCount = n;
+            config.populationSize = pop;
+            config.eliteCount = std::max(1, static_cast<int>(0.03 * pop));
+            config.generations = std::numeric_limits<int>::max();
+            config.threadCount = profile.threadCount;
+            config.parallelThreshold = profile.parallelThreshold;
+            config.localSearchCount = ls;
+            // 時間片由求解器自行於當代結束時截止，背景下界等資源照常收尾
+            config.timeLimitSeconds = burstSlice;
+            config.onGenerationComplete = nullptr;
+            config.onBestImproved = nullptr;
+
+            GASolver solver(config, cities);
+            double reached = solver.solve().distance;
+
+            if (reached < bestDistance) {
+                bestDistance = reached;
+                profile.populationSize = pop;
+                profile.localSearchCount = ls;
+            }
+        }
+    }
+    return profile;
+}
+
+void AutoTuner::apply(const TuningProfile& profile, GAConfig& config) {
+    config.threadCount = profile.threadCount;
+    config.parallelThreshold = profile.parallelThreshold;
+    config.localSearchCount = profile.localSearchCount;
+
+    if (profile.populationSize > 0 && profile.cityCount > 0) {
+        double scale = static_cast<double>(config.cityCount) / profile.cityCount;
+        config.populationSize = std::max(50, static_cast<int>(std::lround(profile.populationSize * scale)));
+        config.eliteCount = std::max(1, static_cast<int>(0.03 * config.populationSize));
+    }
+}
+
+std::string AutoTuner::defaultProfilePath() {
+    std::string host = "unknown-host";
+#ifdef __unix__
+    char buffer[256] = {};
+    if (gethostname(buffer, sizeof(buffer) - 1) == 0 && buffer[0] != '\0') {
+        host = buffer;
+    }
+#endif
+
+    std::filesystem::path dir;
+    if (const char* home = std::getenv("HOME")) {
+        dir = std::filesystem::path(home) / ".cache";
+    } else {
+        std::error_code ec;
+        dir = std::filesystem::temp_directory_path(ec);
+    }
+    return (dir / "ga_tsp_tuning" / (host + ".profile")).string();
+}
+
+bool AutoTuner::saveProfile(const TuningProfile& profile, const std::string& path) {
+    // 保留其他規模級距的紀錄
+    std::vector<std::string> lines;
+    int cls = sizeClass(profile.cityCount);
+    {
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line)) {
+            std::istringstream iss(line);
+            int lineClass;
+            if (iss >> lineClass && lineClass != cls) lines.push_back(line);
+        }
+    }
+
+    std::ostringstream entry;
+    entry << cls << " " << profile.cityCount << " " << profile.threadCount << " "
+          << profile.parallelThreshold << " " << profile.populationSize << " " << profile.localSearchCount;
+    lines.push_back(entry.str());
+
+    std::error_code ec;
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    if (!parent.empty()) std::filesystem::create_directories(parent, ec);
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) return false;
+    out << "# sizeClass cityCount threadCount parallelThreshold populationSize localSearchCount\n";
+    for (const auto& line : lines) {
+        if (!line.empty() && line[0] != '#') out << line << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+bool AutoTuner::loadProfile(const std::string& path, int cityCount, TuningProfile& profile) {
+    std::ifstream in(path);
+    if (!in.is_open()) return false;
+
+    int cls = sizeClass(cityCount);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream iss(line);
+        int lineClass;
+        TuningProfile p;
+        if (!(iss >> lineClass >> p.cityCount >> p.threadCount >> p.parallelThreshold >> p.populationSize >> p.localSearchCount)) {
+            continue; // 損毀的紀錄直接略過
+        }
+        if (lineClass == cls) {
+            profile = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+GAConfig AutoTuner::tunedConfig(const std::vector<City>& cities, double budgetSeconds, const std::string& path) {
+    int n = static_cast<int>(cities.size());
+    GAConfig config = GAConfig::generateDefault(n);
+
+    TuningProfile profile;
+    if (!loadProfile(path, n, profile)) {
+        profile = calibrate(cities, config, budgetSeconds);
+        saveProfile(profile, path);
+    }
+    apply(profile, config);
+    return config;
+}
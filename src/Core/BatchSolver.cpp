@@ -0,0 +1,110 @@
+#include "Core/BatchSolver.h"
+#include "Core/GASolver.h"
+#include <exception>
+#include <stdexcept>
+
+namespace {
+// 目前執行緒所屬的執行緒池 (非工作執行緒為 nullptr)，用於偵測巢狀的 solveAll
+thread_local const BatchSolver* t_currentPool = nullptr;
+}
+
+BatchSolver::BatchSolver(unsigned int workerCount) {
+    if (workerCount == 0) {
+        workerCount = std::thread::hardware_concurrency();
+        if (workerCount == 0) workerCount = 2; // 保底機制
+    }
+
+    m_workers.reserve(workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+BatchSolver::~BatchSolver() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cv.notify_all();
+    for (auto& t : m_workers) {
+        t.join();
+    }
+}
+
+void BatchSolver::submit(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+    }
+    m_cv.notify_one();
+}
+
+void BatchSolver::workerLoop() {
+    t_currentPool = this;
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+            // 收到停止訊號且佇列已清空才離開，確保已投遞的任務都會被執行
+            if (m_jobs.empty()) return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        job();
+    }
+}
+
+std::vector<Individual> BatchSolver::solveAll(const std::vector<std::vector<City>>& instances,
+                                              const ConfigFactory& makeConfig,
+                                              const ResultCallback& onResult) {
+    // 工作執行緒在此阻塞等待，會佔住一個本應執行子任務的執行緒；池內所有執行緒都這麼做時即永久死結
+    if (t_currentPool == this) {
+        throw std::runtime_error("BatchSolver::solveAll must not be called from one of its own worker threads");
+    }
+
+    std::vector<Individual> results(instances.size());
+
+    // 整批共用的完成狀態：計數器、第一個例外與通知用的條件變數
+    std::mutex doneMutex;
+    // 回呼另以獨立的鎖序列化，呼叫期間不持有 doneMutex，回呼本身耗時或阻塞也不會拖住完成計數
+    std::mutex callbackMutex;
+    std::condition_variable doneCv;
+    std::size_t doneCount = 0;
+    std::exception_ptr firstError;
+
+    for (std::size_t idx = 0; idx < instances.size(); ++idx) {
+        submit([&, idx]() {
+            std::exception_ptr error;
+            try {
+                GAConfig config = makeConfig(static_cast<int>(instances[idx].size()));
+                config.cityCount = static_cast<int>(instances[idx].size());
+                // 一個核心一個求解：關閉求解器內部的平行評估，避免巢狀平行化
+                config.useParallel = false;
+
+                GASolver solver(config, instances[idx]);
+                results[idx] = solver.solve(); // 各任務只寫入自己的欄位，不需加鎖
+                if (onResult) {
+                    std::lock_guard<std::mutex> callbackLock(callbackMutex);
+                    onResult(idx, results[idx]);
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(doneMutex);
+            if (error && !firstError) firstError = error;
+            ++doneCount;
+            doneCv.notify_one();
+        });
+    }
+
+    // 等待整批完成 (Blocking Wait)
+    std::unique_lock<std::mutex> lock(doneMutex);
+    doneCv.wait(lock, [&]() { return doneCount == instances.size(); });
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+    return results;
+}
@@ -0,0 +1,315 @@
+#include "Core/DecompositionSolver.h"
+#include "Core/BatchSolver.h"
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <thread>
+
+namespace {
+// 平行執行 [0, count) 的獨立工作，區段數等於硬體執行緒數
+template <typename Func>
+void parallelFor(int count, Func&& body) {
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 2; // 保底機制
+    int batchSize = std::max(1, static_cast<int>((count + numThreads - 1) / numThreads));
+
+    std::vector<std::future<void>> futures;
+    for (int start = 0; start < count; start += batchSize) {
+        int end = std::min(count, start + batchSize);
+        futures.push_back(std::async(std::launch::async, [&body, start, end]() {
+            for (int i = start; i < end; ++i) body(i);
+        }));
+    }
+    for (auto& f : futures) {
+        f.get();
+    }
+}
+
+// 座標點到城市的距離 (用於群中心)
+double pointDist(double x, double y, const City& c) {
+    double dx = x - c.x;
+    double dy = y - c.y;
+    return std::sqrt(dx * dx + dy * dy);
+}
+}
+
+DecompositionSolver::DecompositionSolver(const DecompositionConfig& config, const std::vector<City>& cities)
+    : m_config(config), m_cities(cities) {
+}
+
+double DecompositionSolver::dist(int a, int b) const {
+    double dx = m_cities[a].x - m_cities[b].x;
+    double dy = m_cities[a].y - m_cities[b].y;
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+double DecompositionSolver::tourLength(const std::vector<int>& tour) const {
+    double total = 0.0;
+    int n = static_cast<int>(tour.size());
+    for (int i = 0; i < n; ++i) {
+        total += dist(tour[i], tour[(i + 1) % n]);
+    }
+    return total;
+}
+
+Individual DecompositionSolver::solve() {
+    Individual result;
+    int n = static_cast<int>(m_cities.size());
+    if (n == 0) return result;
+
+    // --- 1. 空間分群 ---
+    partition();
+    int k = static_cast<int>(m_clusters.size());
+
+    // --- 2. 平行求解子問題 (3 個城市以下的任意順序皆為最優，不需 GA) ---
+    std::vector<std::vector<int>> subTours(k);
+    std::vector<std::vector<City>> instances;
+    std::vector<int> instanceCluster;
+    for (int c = 0; c < k; ++c) {
+        if (m_clusters[c].size() <= 3) {
+            subTours[c] = m_clusters[c];
+            continue;
+        }
+        std::vector<City> local;
+        local.reserve(m_clusters[c].size());
+        for (size_t i = 0; i < m_clusters[c].size(); ++i) {
+            const City& city = m_cities[m_clusters[c][i]];
+            local.push_back({static_cast<int>(i), city.x, city.y});
+        }
+        instances.push_back(std::move(local));
+        instanceCluster.push_back(c);
+    }
+
+    if (!instances.empty()) {
+        BatchSolver batch(m_config.workerCount);
+        batch.solveAll(instances, m_config.clusterConfig, [&](std::size_t idx, const Individual& best) {
+            int c = instanceCluster[idx];
+            subTours[c].resize(best.path.size());
+            for (size_t i = 0; i < best.path.size(); ++i) {
+                subTours[c][i] = m_clusters[c][best.path[i]]; // 區域索引 → 全域索引
+            }
+        });
+    }
+
+    // --- 3. 串接子迴路 ---
+    std::vector<int> junctions;
+    std::vector<int> tour = stitch(subTours, orderClusters(), junctions);
+
+    // --- 4. 邊界視窗重新優化 ---
+    int w = std::min(m_config.windowSize, n);
+    for (int pass = 0; pass < m_config.refinementPasses; ++pass) {
+        std::vector<int> starts;
+        if (pass == 0) {
+            // 第一回合：以每個交界處為中心，保留互不重疊的視窗
+            int lastEnd = std::numeric_limits<int>::min();
+            for (int j : junctions) {
+                int s = j - w / 2;
+                if (s < lastEnd) continue;
+                starts.push_back((s + n) % n);
+                lastEnd = s + w;
+            }
+            // 首尾視窗可能因環狀繞回而重疊
+            if (starts.size() > 1 && junctions.front() - w / 2 + n < lastEnd) starts.erase(starts.begin());
+        } else {
+            // 後續回合：以位移的方式鋪滿整條路徑，讓交界外的劣質邊也有機會被修補
+            int offset = (pass * w / 3) % std::max(1, w);
+            for (int t = 0; t < n / w; ++t) starts.push_back((offset + t * w) % n);
+        }
+
+        // 視窗互不重疊，可安全地平行優化
+        parallelFor(static_cast<int>(starts.size()), [&](int i) {
+            optimizeWindow(tour, starts[i]);
+        });
+    }
+
+    result.path = std::move(tour);
+    result.distance = tourLength(result.path);
+    result.fitness = 1.0 / (result.distance + 1.0);
+    return result;
+}
+
+void DecompositionSolver::partition() {
+    int n = static_cast<int>(m_cities.size());
+    int clusterSize = std::max(1, m_config.clusterSize);
+    int k = std::max(1, (n + clusterSize - 1) / clusterSize);
+
+    // 1. 以 Hilbert 順序切成 k 塊作為初始中心 (比隨機初始化穩定且可重現)
+    std::vector<int> hilbert = Utils::hilbertOrder(m_cities);
+    std::vector<int> rank(n);
+    for (int i = 0; i < n; ++i) rank[hilbert[i]] = i;
+
+    std::vector<double> cx(k, 0.0), cy(k, 0.0);
+    std::vector<int> label(n);
+    for (int i = 0; i < n; ++i) {
+        label[hilbert[i]] = static_cast<int>(static_cast<long long>(i) * k / n);
+    }
+
+    // 2. Lloyd 迭代：更新中心 → 平行重新指派
+    for (int iter = 0; iter <= m_config.kmeansIterations; ++iter) {
+        std::vector<double> sumX(k, 0.0), sumY(k, 0.0);
+        std::vector<int> count(k, 0);
+        for (int i = 0; i < n; ++i) {
+            sumX[label[i]] += m_cities[i].x;
+            sumY[label[i]] += m_cities[i].y;
+            count[label[i]]++;
+        }
+        for (int c = 0; c < k; ++c) {
+            if (count[c] > 0) { // 空群保留舊中心
+                cx[c] = sumX[c] / count[c];
+                cy[c] = sumY[c] / count[c];
+            }
+        }
+        if (iter == m_config.kmeansIterations) break;
+
+        parallelFor(n, [&](int i) {
+            int best = label[i];
+            double bestDist = pointDist(cx[best], cy[best], m_cities[i]);
+            for (int c = 0; c < k; ++c) {
+                double d = pointDist(cx[c], cy[c], m_cities[i]);
+                if (d < bestDist) {
+                    bestDist = d;
+                    best = c;
+                }
+            }
+            label[i] = best;
+        });
+    }
+
+    // 3. 收集各群成員，過大的群 (> 2 倍目標) 依 Hilbert 順序再切塊
+    std::vector<std::vector<int>> groups(k);
+    for (int i = 0; i < n; ++i) groups[label[i]].push_back(i);
+
+    m_clusters.clear();
+    for (auto& g : groups) {
+        if (g.empty()) continue;
+        if (static_cast<int>(g.size()) <= 2 * clusterSize) {
+            m_clusters.push_back(std::move(g));
+            continue;
+        }
+        std::sort(g.begin(), g.end(), [&rank](int a, int b) { return rank[a] < rank[b]; });
+        int pieces = (static_cast<int>(g.size()) + clusterSize - 1) / clusterSize;
+        for (int p = 0; p < pieces; ++p) {
+            size_t from = g.size() * p / pieces;
+            size_t to = g.size() * (p + 1) / pieces;
+            m_clusters.emplace_back(g.begin() + from, g.begin() + to);
+        }
+    }
+}
+
+std::vector<int> DecompositionSolver::orderClusters() const {
+    int k = static_cast<int>(m_clusters.size());
+    std::vector<int> order(k);
+    std::iota(order.begin(), order.end(), 0);
+    if (k < 4) return order;
+
+    // 以群中心構成一個小型 TSP，沿用 GASolver 求出拜訪順序
+    std::vector<City> centroids(k);
+    for (int c = 0; c < k; ++c) {
+        double sx = 0.0, sy = 0.0;
+        for (int i : m_clusters[c]) {
+            sx += m_cities[i].x;
+            sy += m_cities[i].y;
+        }
+        centroids[c] = {c, sx / m_clusters[c].size(), sy / m_clusters[c].size()};
+    }
+
+    GAConfig config = GAConfig::generateDefault(k);
+    config.generations = std::min(config.generations, 500);
+    GASolver solver(config, centroids);
+    return solver.solve().path;
+}
+
+std::vector<int> DecompositionSolver::stitch(const std::vector<std::vector<int>>& subTours,
+                                             const std::vector<int>& order,
+                                             std::vector<int>& junctions) const {
+    int k = static_cast<int>(order.size());
+    std::vector<int> tour;
+    tour.reserve(m_cities.size());
+    junctions.clear();
+
+    // 各群中心，作為「上一群出口 / 下一群入口」尚未確定時的參考點
+    std::vector<double> cx(k), cy(k);
+    for (int c = 0; c < k; ++c) {
+        double sx = 0.0, sy = 0.0;
+        for (int i : subTours[c]) {
+            sx += m_cities[i].x;
+            sy += m_cities[i].y;
+        }
+        cx[c] = sx / subTours[c].size();
+        cy[c] = sy / subTours[c].size();
+    }
+
+    for (int q = 0; q < k; ++q) {
+        const std::vector<int>& t = subTours[order[q]];
+        int m = static_cast<int>(t.size());
+
+        // 入口參考點：上一群的出口城市 (第一群則用最後一群的中心)
+        int prevCluster = order[(q - 1 + k) % k];
+        double px = tour.empty() ? cx[prevCluster] : m_cities[tour.back()].x;
+        double py = tour.empty() ? cy[prevCluster] : m_cities[tour.back()].y;
+        // 出口參考點：下一群的中心 (最後一群則用全域路徑的起點)
+        int nextCluster = order[(q + 1) % k];
+        double nx = (q == k - 1 && !tour.empty()) ? m_cities[tour.front()].x : cx[nextCluster];
+        double ny = (q == k - 1 && !tour.empty()) ? m_cities[tour.front()].y : cy[nextCluster];
+
+        junctions.push_back(static_cast<int>(tour.size()));
+        if (m == 1) {
+            tour.push_back(t[0]);
+            continue;
+        }
+
+        // 枚舉切斷邊 (t[p], t[p+1]) 與走訪方向，最小化「接入 + 接出 - 被切斷邊」
+        int bestP = 0;
+        bool bestForward = true;
+        double bestCost = std::numeric_limits<double>::max();
+        for (int p = 0; p < m; ++p) {
+            int a = t[p], b = t[(p + 1) % m];
+            double cut = dist(a, b);
+            double forward = pointDist(px, py, m_cities[b]) + pointDist(nx, ny, m_cities[a]) - cut;
+            double backward = pointDist(px, py, m_cities[a]) + pointDist(nx, ny, m_cities[b]) - cut;
+            if (forward < bestCost) { bestCost = forward; bestP = p; bestForward = true; }
+            if (backward < bestCost) { bestCost = backward; bestP = p; bestForward = false; }
+        }
+
+        for (int s = 0; s < m; ++s) {
+            // 正向：b = t[p+1] 出發繞一圈到 a；反向：a = t[p] 出發倒著走到 b
+            int idx = bestForward ? (bestP + 1 + s) % m : (bestP - s + m) % m;
+            tour.push_back(t[idx]);
+        }
+    }
+    return tour;
+}
+
+double DecompositionSolver::optimizeWindow(std::vector<int>& tour, int start) const {
+    int n = static_cast<int>(tour.size());
+    int w = std::min(m_config.windowSize, n);
+    if (w < 4) return 0.0;
+
+    std::vector<int> local(w);
+    for (int i = 0; i < w; ++i) local[i] = tour[(start + i) % n];
+
+    // 固定視窗兩端的 2-Opt：只翻轉內部子路徑，不影響視窗外的連接
+    double totalGain = 0.0;
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (int i = 1; i < w - 2; ++i) {
+            for (int j = i + 1; j < w - 1; ++j) {
+                double delta = dist(local[i - 1], local[j]) + dist(local[i], local[j + 1])
+                             - dist(local[i - 1], local[i]) - dist(local[j], local[j + 1]);
+                if (delta < -1e-10) {
+                    std::reverse(local.begin() + i, local.begin() + j + 1);
+                    totalGain -= delta;
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < w; ++i) tour[(start + i) % n] = local[i];
+    return totalGain;
+}
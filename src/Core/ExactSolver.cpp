@@ -0,0 +1,143 @@
+#include "Core/ExactSolver.h"
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+std::size_t ExactSolver::memoryRequired(int n) {
+    if (n <= 2) return 0;
+    std::size_t m = static_cast<std::size_t>(n - 1);
+    // 相鄰兩層的 dp 值：取 C(m, s-1) + C(m, s) 的最大值
+    std::size_t widest = 0;
+    std::size_t prevLayer = 1; // C(m, 0)
+    for (std::size_t s = 1; s <= m; ++s) {
+        std::size_t layer = prevLayer * (m - s + 1) / s;
+        widest = std::max(widest, prevLayer + layer);
+        prevLayer = layer;
+    }
+    // 回溯指標 + 依 popcount 分層的子集清單 + 子集的層內序號
+    std::size_t perSubset = m * sizeof(std::uint8_t) + 2 * sizeof(std::uint32_t);
+    return (std::size_t(1) << m) * perSubset + widest * m * sizeof(double);
+}
+
+Individual ExactSolver::solve(const std::vector<double>& distMatrix, int n, bool useParallel) {
+    if (n < 1 || n > kMaxCities) {
+        throw std::runtime_error("ExactSolver supports 1 to " + std::to_string(kMaxCities) +
+                                 " cities, got " + std::to_string(n));
+    }
+
+    Individual result;
+    auto d = [&distMatrix, n](int a, int b) { return distMatrix[static_cast<std::size_t>(a) * n + b]; };
+
+    if (n <= 2) {
+        for (int i = 0; i < n; ++i) result.path.push_back(i);
+        result.distance = (n == 2) ? d(0, 1) + d(1, 0) : 0.0;
+        result.fitness = 1.0 / (result.distance + 1.0);
+        return result;
+    }
+
+    // 城市 1..n-1 對應位元 0..m-1，城市 0 固定為起點
+    const int m = n - 1;
+    const std::uint32_t full = (std::uint32_t(1) << m) - 1;
+
+    // 依 popcount 將子集分層，並記錄每個子集在所屬層內的序號 (dp 值以此定址)
+    std::vector<std::vector<std::uint32_t>> layers(m + 1);
+    std::vector<std::uint32_t> indexInLayer(static_cast<std::size_t>(full) + 1);
+    for (std::uint32_t mask = 1; mask <= full; ++mask) {
+        auto& layer = layers[__builtin_popcount(mask)];
+        indexInLayer[mask] = static_cast<std::uint32_t>(layer.size());
+        layer.push_back(mask);
+    }
+
+    // 回溯指標：parent[mask * m + j] 為停在 j 之前拜訪的城市位元 (m ≤ 21，一個位元組足夠)
+    std::vector<std::uint8_t> parent(static_cast<std::size_t>(full + 1) * m);
+
+    // 只保留上一層與本層的 dp 值 (每個子集 m 欄，僅集合內的欄位有效)
+    std::vector<double> prevDp(layers[1].size() * m);
+    std::vector<double> curDp;
+    for (int j = 0; j < m; ++j) {
+        prevDp[static_cast<std::size_t>(indexInLayer[std::uint32_t(1) << j]) * m + j] = d(0, j + 1);
+    }
+
+    // 單一子集的轉移：只讀取上一層，寫入本子集的欄位，不同子集之間互不衝突
+    auto relax = [&](std::uint32_t mask) {
+        double* row = &curDp[static_cast<std::size_t>(indexInLayer[mask]) * m];
+        for (int j = 0; j < m; ++j) {
+            if (!(mask & (std::uint32_t(1) << j))) continue;
+            std::uint32_t prev = mask ^ (std::uint32_t(1) << j);
+            const double* prevRow = &prevDp[static_cast<std::size_t>(indexInLayer[prev]) * m];
+            double best = std::numeric_limits<double>::max();
+            int arg = 0;
+            for (int k = 0; k < m; ++k) {
+                if (!(prev & (std::uint32_t(1) << k))) continue;
+                double v = prevRow[k] + d(k + 1, j + 1);
+                if (v < best) {
+                    best = v;
+                    arg = k;
+                }
+            }
+            row[j] = best;
+            parent[static_cast<std::size_t>(mask) * m + j] = static_cast<std::uint8_t>(arg);
+        }
+    };
+
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 2; // 保底機制
+
+    for (int size = 2; size <= m; ++size) {
+        const auto& layer = layers[size];
+        curDp.resize(layer.size() * m);
+        // 層太小時執行緒啟動成本高於計算本身
+        if (!useParallel || numThreads == 1 || layer.size() < 2048) {
+            for (std::uint32_t mask : layer) relax(mask);
+        } else {
+            std::size_t batchSize = (layer.size() + numThreads - 1) / numThreads;
+            std::vector<std::future<void>> futures;
+            for (std::size_t start = 0; start < layer.size(); start += batchSize) {
+                std::size_t end = std::min(layer.size(), start + batchSize);
+                futures.push_back(std::async(std::launch::async, [&layer, &relax, start, end]() {
+                    for (std::size_t i = start; i < end; ++i) relax(layer[i]);
+                }));
+            }
+            for (auto& f : futures) {
+                f.get();
+            }
+        }
+        prevDp.swap(curDp);
+    }
+
+    // 回到起點 (最後一層只有 full 一個子集)
+    int last = 0;
+    double bestTour = std::numeric_limits<double>::max();
+    for (int j = 0; j < m; ++j) {
+        double v = prevDp[j] + d(j + 1, 0);
+        if (v < bestTour) {
+            bestTour = v;
+            last = j;
+        }
+    }
+
+    // 沿回溯指標由終點往回還原路徑
+    std::vector<int> reversed;
+    std::uint32_t mask = full;
+    while (true) {
+        reversed.push_back(last + 1);
+        std::uint32_t prev = mask ^ (std::uint32_t(1) << last);
+        if (prev == 0) break;
+        last = parent[static_cast<std::size_t>(mask) * m + last];
+        mask = prev;
+    }
+
+    result.path.push_back(0);
+    result.path.insert(result.path.end(), reversed.rbegin(), reversed.rend());
+    // 以路徑順序重新累加，與 evaluateIndividual 的加總順序一致
+    result.distance = 0.0;
+    for (int i = 0; i < n; ++i) {
+        result.distance += d(result.path[i], result.path[(i + 1) % n]);
+    }
+    result.fitness = 1.0 / (result.distance + 1.0);
+    return result;
+}
@@ -0,0 +1,46 @@
+#include "Core/FitnessCache.h"
+#include <algorithm>
+
+FitnessCache::FitnessCache(std::size_t capacity, std::size_t shardCount) {
+    shardCount = std::max<std::size_t>(1, shardCount);
+    m_shardCapacity = std::max<std::size_t>(1, capacity / shardCount);
+
+    m_shards.reserve(shardCount);
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        m_shards.push_back(std::make_unique<Shard>());
+    }
+}
+
+bool FitnessCache::lookup(std::uint64_t hash, double& distance) {
+    Shard& shard = shardFor(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.entries.find(hash);
+    if (it == shard.entries.end()) {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    distance = it->second;
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void FitnessCache::insert(std::uint64_t hash, double distance) {
+    Shard& shard = shardFor(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // 超出容量時整片清空 (簡化的淘汰策略)
+    if (shard.entries.size() >= m_shardCapacity) {
+        shard.entries.clear();
+    }
+    shard.entries[hash] = distance;
+}
+
+void FitnessCache::clear() {
+    for (auto& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->entries.clear();
+    }
+    m_hits.store(0, std::memory_order_relaxed);
+    m_misses.store(0, std::memory_order_relaxed);
+}
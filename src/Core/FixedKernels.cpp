@@ -0,0 +1,165 @@
+#include "Core/FixedKernels.h"
+#include "Core/TourHash.h"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+
+/** @brief 規模等級內最小的城市編號型別 */
+template <int MaxN>
+using CityIndex = typename std::conditional<(MaxN <= 256), std::uint8_t, std::uint16_t>::type;
+
+/**
+ * @brief 以 p2 的雜湊增量推得 OX 子代的雜湊
+ * * 子代 = p1 的片段 S + p2 自 end + 1 起的環狀序列 q 去除 S 的城市。因此由 p2 的雜湊出發：
+ * 移除 q 中碰觸 S 的邊與 q 的收尾邊 (q 被切成線性序列)，補上跨越 S 城市的橋接邊，
+ * 再加入片段內部的邊與兩條接縫邊。只有碰觸 S 的邊需要計算金鑰，其餘為位元測試。
+ * @param inSegment 判斷城市是否屬於片段的謂詞 (由各核心的已拜訪標記提供)
+ */
+template <typename InSegment>
+std::uint64_t crossoverHash(const int* p1, const int* p2, int n, int start, int end, const int* child,
+                            std::uint64_t p2Hash, InSegment inSegment) {
+    std::uint64_t hash = p2Hash ^ TourHash::edgeKey(p2[end], p2[(end + 1) % n]);
+
+    int prev = p2[(end + 1) % n];
+    bool prevIn = inSegment(prev);
+    int lastOut = prevIn ? -1 : prev; // 最近一個不屬於片段的城市
+    auto visit = [&](int c) {
+        bool in = inSegment(c);
+        if (in || prevIn) hash ^= TourHash::edgeKey(prev, c);
+        if (!in) {
+            if (prevIn && lastOut >= 0) hash ^= TourHash::edgeKey(lastOut, c);
+            lastOut = c;
+        }
+        prev = c;
+        prevIn = in;
+    };
+    for (int i = end + 2; i < n; ++i) visit(p2[i]);
+    for (int i = (end + 2 > n) ? 1 : 0; i <= end; ++i) visit(p2[i]);
+
+    for (int i = start; i < end; ++i) hash ^= TourHash::edgeKey(p1[i], p1[i + 1]);
+    hash ^= TourHash::edgeKey(p1[end], child[(end + 1) % n]);
+    hash ^= TourHash::edgeKey(child[(start - 1 + n) % n], p1[start]);
+    return hash == 0 ? 1 : hash; // 與 TourHash::compute 相同：0 保留為「未計算」
+}
+
+/** @brief 是否值得以增量方式計算子代雜湊 (約 4L 次金鑰運算 vs. n 次) */
+inline bool incrementalCrossoverHash(int n, int start, int end, std::uint64_t p2Hash) {
+    return p2Hash != 0 && 4 * (end - start + 1) < n;
+}
+
+} // namespace
+
+double FixedKernels::tourLength(const std::vector<int>& path, const std::vector<double>& distMatrix, int n) {
+    const int* p = path.data();
+    const double* dist = distMatrix.data();
+    double total = 0.0;
+    if (n <= 46340) {
+        // n * n 不超過 int 範圍：列偏移以 32 位元計算，不需延伸至 64 位元的位址運算
+        for (int i = 0; i < n - 1; ++i) {
+            total += dist[p[i] * n + p[i + 1]];
+        }
+        return total + dist[p[n - 1] * n + p[0]];
+    }
+
+    // 超大實例：列偏移需以 size_t 計算以免溢位
+    for (int i = 0; i < n - 1; ++i) {
+        total += dist[static_cast<std::size_t>(p[i]) * n + p[i + 1]];
+    }
+    return total + dist[static_cast<std::size_t>(p[n - 1]) * n + p[0]];
+}
+
+void FixedKernels::crossoverOX(const std::vector<int>& p1, const std::vector<int>& p2, int start, int end,
+                               std::vector<int>& child, std::uint64_t* hash, std::uint64_t p2Hash) {
+    int n = static_cast<int>(p1.size());
+    child.resize(n);
+    // 增量雜湊需要片段的城市標記，交由各核心在標記仍有效時計算
+    std::uint64_t* incremental = (hash && incrementalCrossoverHash(n, start, end, p2Hash)) ? hash : nullptr;
+    if (n <= 64) {
+        crossoverOXImpl<64>(p1.data(), p2.data(), n, start, end, child.data(), incremental, p2Hash);
+    } else if (n <= 256) {
+        crossoverOXImpl<256>(p1.data(), p2.data(), n, start, end, child.data(), incremental, p2Hash);
+    } else if (n <= 1024) {
+        crossoverOXImpl<1024>(p1.data(), p2.data(), n, start, end, child.data(), incremental, p2Hash);
+    } else {
+        crossoverOXGeneric(p1.data(), p2.data(), n, start, end, child.data(), incremental, p2Hash);
+    }
+    if (hash && !incremental) *hash = TourHash::compute(child);
+}
+
+template <int MaxN>
+void FixedKernels::crossoverOXImpl(const int* p1, const int* p2, int n, int start, int end, int* child,
+                                   std::uint64_t* hash, std::uint64_t p2Hash) {
+    std::bitset<MaxN> visited;
+    std::array<CityIndex<MaxN>, MaxN> fill; // p2 中未出現於片段的城市，依環狀順序排列
+
+    for (int i = start; i <= end; ++i) {
+        child[i] = p1[i];
+        visited.set(p1[i]);
+    }
+
+    // 無分支收集：永遠寫入，只有未拜訪時才前進指標
+    int count = 0;
+    for (int i = end + 1; i < n; ++i) {
+        fill[count] = static_cast<CityIndex<MaxN>>(p2[i]);
+        count += !visited[p2[i]];
+    }
+    for (int i = 0; i <= end; ++i) {
+        fill[count] = static_cast<CityIndex<MaxN>>(p2[i]);
+        count += !visited[p2[i]];
+    }
+
+    // 子代的空位同樣自 end + 1 起環狀排列：先填 (end, n)，再填 [0, start)
+    int k = 0;
+    for (int i = end + 1; i < n; ++i) child[i] = fill[k++];
+    for (int i = 0; i < start; ++i) child[i] = fill[k++];
+
+    if (hash) {
+        *hash = crossoverHash(p1, p2, n, start, end, child, p2Hash, [&visited](int c) { return visited[c]; });
+    }
+}
+
+void FixedKernels::crossoverOXGeneric(const int* p1, const int* p2, int n, int start, int end, int* child,
+                                      std::uint64_t* hash, std::uint64_t p2Hash) {
+    // 以代數標記取代每次清空：stamp[c] == epoch 代表城市 c 已在片段中
+    thread_local std::vector<std::uint32_t> stamp;
+    thread_local std::vector<int> fill;
+    thread_local std::uint32_t epoch = 0;
+    if (static_cast<int>(stamp.size()) < n) {
+        stamp.assign(n, 0);
+        fill.resize(n);
+        epoch = 0;
+    }
+    if (++epoch == 0) {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        epoch = 1;
+    }
+
+    for (int i = start; i <= end; ++i) {
+        child[i] = p1[i];
+        stamp[p1[i]] = epoch;
+    }
+
+    int count = 0;
+    for (int i = end + 1; i < n; ++i) {
+        fill[count] = p2[i];
+        count += stamp[p2[i]] != epoch;
+    }
+    for (int i = 0; i <= end; ++i) {
+        fill[count] = p2[i];
+        count += stamp[p2[i]] != epoch;
+    }
+
+    int k = 0;
+    for (int i = end + 1; i < n; ++i) child[i] = fill[k++];
+    for (int i = 0; i < start; ++i) child[i] = fill[k++];
+
+    if (hash) {
+        std::uint32_t current = epoch;
+        *hash = crossoverHash(p1, p2, n, start, end, child, p2Hash, [current](int c) { return stamp[c] == current; });
+    }
+}
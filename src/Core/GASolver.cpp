@@ -1,46 +1,168 @@
 #include "Core/GASolver.h"
 #include "Core/Utils.h"
+#include "Core/TourHash.h"
+#include "Core/TourConstructor.h"
+#include "Core/LocalSearch.h"
+#include "Core/ExactSolver.h"
+#include "Core/FixedKernels.h"
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <cmath>
 #include <iostream>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
 
+namespace {
+// 族群達此規模才平行選取精英；較小時 nth_element 本身只需數微秒，不值得建立執行緒
+constexpr int kParallelRankThreshold = 16384;
+
+// 演化暫存 (排名鍵與親代池) 至少填滿一個大分頁才建立配置區；較小時整段 2 MB 幾乎全數閒置，不如留在一般堆積
+std::unique_ptr<HugePageArena> makeScratchArena(const GAConfig& config) {
+    if (!config.useHugePages) return nullptr;
+    std::size_t bytes = GASolver::estimateFootprint(config).scratch;
+    if (bytes < HugePageArena::kHugePageSize) return nullptr;
+    return std::make_unique<HugePageArena>(bytes);
+}
+}
 
 // 把族群建立起來，並利用查表來計算路徑長度。
 GASolver::GASolver(const GAConfig& config, const std::vector<City>& cities)
-    : m_config(config), m_cities(cities) {
-    // 預計算距離矩陣，存入 m_distMatrix
-    m_distMatrix = Utils::precomputeDistanceMatrix(m_cities);
+    // 預計算距離矩陣 (平行模式下以多執行緒分磚建構)；選用 Hilbert 重新編號，使地理上相鄰的城市在矩陣中也相鄰
+    : GASolver(config, ProblemInstance::create(cities, config.renumberCities,
+                                               config.useParallel ? config.threadCount : 1, config.useHugePages)) {}
+
+GASolver::GASolver(const GAConfig& config, std::shared_ptr<const ProblemInstance> instance)
+    : m_config(config), m_instance(std::move(instance)),
+      m_arena(makeScratchArena(config)),
+      m_rankKeys(ArenaAllocator<std::pair<double, int>>(m_arena.get())),
+      m_selectionPool(ArenaAllocator<int>(m_arena.get())) {
+    if (!m_instance) {
+        throw std::runtime_error("GASolver: problem instance is null.");
+    }
+    if (m_instance->cityCount() != m_config.cityCount) {
+        throw std::runtime_error("GASolver: config.cityCount (" + std::to_string(m_config.cityCount) +
+                                 ") does not match the instance (" + std::to_string(m_instance->cityCount()) + ").");
+    }
+    m_evaluator.setThreading(m_config.threadCount, m_config.parallelThreshold);
+
+    // 暫存區大小在整次求解中固定：先保留完整容量，之後不再重新配置 (配置區不支援個別釋放)
+    if (m_arena) {
+        m_rankKeys.reserve(m_config.populationSize);
+        m_selectionPool.reserve(2 * static_cast<std::size_t>(m_config.populationSize));
+    }
+
+    // NUMA 感知：偵測拓撲並在各節點建立本地矩陣複本
+    if (m_config.numaAware) {
+        m_topology = NumaTopology::detect();
+        buildNodeReplicas();
+    }
+}
+
+void GASolver::buildNodeReplicas() {
+    int nodes = m_topology.nodeCount();
+    if (nodes <= 1) return;
+
+    m_distReplicas.assign(nodes, std::vector<double>());
+    std::vector<std::thread> workers;
+    for (int node = 0; node < nodes; ++node) {
+        workers.emplace_back([this, node]() {
+            // 先綁定到目標節點，再由本執行緒配置並寫入 (First-Touch)
+            NumaTopology::pinCurrentThread(m_topology.cpusOfNode(node).front());
+            const std::vector<double>& source = m_instance->distances();
+            std::vector<double>& replica = m_distReplicas[node];
+            replica.reserve(source.size());
+            if (m_config.useHugePages) HugePageArena::advise(replica.data(), source.size() * sizeof(double));
+            replica.assign(source.begin(), source.end());
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
 }
 
 void GASolver::initPopulation() {
-    m_population.resize(m_config.populationSize);
-    int n = m_config.cityCount;
+    m_population.assign(m_config.populationSize, Individual());
+    int popSize = m_config.populationSize;
 
-    for (auto& ind : m_population) {
-        ind.path.resize(n);
-        // 1. 產生 [0, 1, 2, ..., n-1] 的序列
-        std::iota(ind.path.begin(), ind.path.end(), 0);
-        // 2. 隨機打亂路徑
-        std::shuffle(ind.path.begin(), ind.path.end(), Utils::getGenerator());
-        
-        // --- 這裡不再呼叫 evaluateIndividual(ind) ---
+    // 貪婪邊法與最近鄰居法共用實例快取的近鄰清單 (第一次使用時建立，之後的求解直接沿用)
+    static const std::vector<std::vector<int>> noCandidates;
+    const std::vector<std::vector<int>>& candidates =
+        (m_config.initGreedyEdgeRatio > 0.0 || m_config.initNearestNeighborRatio > 0.0) ? m_instance->neighbors()
+                                                                                      : noCandidates;
+
+    if (m_config.useParallel && popSize > m_config.parallelThreshold) {
+        // 各區段互不重疊，且隨機數引擎為 thread_local，可直接平行建構
+        unsigned int numThreads = m_evaluator.workerCount();
+        std::vector<std::future<void>> futures;
+        for (unsigned int worker = 0; worker < numThreads; ++worker) {
+            std::pair<int, int> range = ParallelEvaluator::batchRange(popSize, numThreads, worker);
+            if (range.first >= range.second) continue;
+            futures.push_back(std::async(std::launch::async, [this, range, worker, &candidates]() {
+                // NUMA 感知：與評估器相同的批次切分與 worker → CPU 對應，讓初始路徑由之後評估它的節點首次寫入
+                if (m_config.numaAware) {
+                    NumaTopology::pinCurrentThread(m_topology.cpuForWorker(worker));
+                }
+                buildInitialTours(range.first, range.second, candidates);
+            }));
+        }
+        for (auto& f : futures) {
+            f.get();
+        }
+    } else {
+        buildInitialTours(0, popSize, candidates);
+    }
+
+    // 評估器持有指向本物件成員的指標，因此在每次初始化時 (而非建構時) 設定
+    if (m_config.numaAware) {
+        std::vector<const std::vector<double>*> replicas;
+        for (const auto& r : m_distReplicas) {
+            replicas.push_back(&r);
+        }
+        m_evaluator.setPlacement(&m_topology, std::move(replicas));
     }
 
     // 3. 【關鍵】初始化完畢後，統一進行第一次評估
     // 這樣可以保證進入 solve() 的第一個迴圈時，大家都有分數了
-    m_evaluator.evaluate(m_population, m_distMatrix, m_config.cityCount, m_config.useParallel);
+    m_evaluator.evaluate(m_population, m_instance->distances(), m_config.cityCount, m_config.useParallel, activeCache());
 }
 
-void GASolver::evaluateIndividual(Individual& ind) {
-    double totalDist = 0.0;
+void GASolver::buildInitialTours(int begin, int end, const std::vector<std::vector<int>>& candidates) {
     int n = m_config.cityCount;
+    int popSize = m_config.populationSize;
 
-    for (int i = 0; i < n; ++i) {
-        int from = ind.path[i];
-        int to = ind.path[(i + 1) % n]; // 回到起點形成封閉迴路
-        totalDist += Utils::getDistance(from, to, m_distMatrix, n);
+    // 依比例切出各建構法負責的索引區間：[0, nn) 最近鄰居、[nn, greedy) 貪婪邊、[greedy, sfc) 空間填充曲線
+    int nnEnd = std::min(static_cast<int>(m_config.initNearestNeighborRatio * popSize),
+                         std::max(0, m_config.initNearestNeighborLimit));
+    int greedyEnd = nnEnd + static_cast<int>(m_config.initGreedyEdgeRatio * popSize);
+    int sfcEnd = greedyEnd + static_cast<int>(m_config.initSpaceFillingRatio * popSize);
+
+    for (int i = begin; i < end; ++i) {
+        Individual& ind = m_population[i];
+        if (i < nnEnd) {
+            ind.path = TourConstructor::nearestNeighbor(m_instance->distances(), n, candidates);
+        } else if (i < greedyEnd) {
+            ind.path = TourConstructor::greedyEdge(m_instance->distances(), n, candidates);
+        } else if (i < sfcEnd) {
+            ind.path = TourConstructor::spaceFillingCurve(m_instance->cities());
+        } else {
+            ind.path.resize(n);
+            // 1. 產生 [0, 1, 2, ..., n-1] 的序列
+            std::iota(ind.path.begin(), ind.path.end(), 0);
+            // 2. 隨機打亂路徑
+            Utils::shuffle(ind.path.begin(), ind.path.end());
+        }
     }
+}
+
+void GASolver::evaluateIndividual(Individual& ind) {
+    // 封閉迴路長度，依 n 分派至固定大小核心
+    double totalDist = FixedKernels::tourLength(ind.path, m_instance->distances(), m_config.cityCount);
 
     ind.distance = totalDist;
     ind.fitness = 1.0 / totalDist; // 距離越短，適應度越高
@@ -51,34 +173,17 @@ void GASolver::evaluateIndividual(Individual& ind) {
 Individual GASolver::crossoverOX(const Individual& p1, const Individual& p2) {
     int n = m_config.cityCount;
     Individual child;
-    child.path.assign(n, -1); // -1 標記為未填充
-    std::vector<bool> visited(n, false); // O(1) 查表：記錄哪些城市已放入小孩路徑
 
     // 1. 隨機選取切點 (Cut Points)
     int start = Utils::getRandomInt(0, n - 2);
     int end = Utils::getRandomInt(start + 1, n - 1);
 
-    // 2. 繼承親代 1 的中間片段 (Segment Inheritance)
-    // 目的：保留親代 A 的局部優良路徑結構
-    for (int i = start; i <= end; ++i) {
-        child.path[i] = p1.path[i];
-        visited[p1.path[i]] = true; // 標記已訪問，避免重複
-    }
-
-    // 3. 環狀填補 (Circular Filling)
-    // 目的：按照親代 2 的順序填補剩餘位置，同時保護「環狀鄰接關係 (Circular Adjacency)」
-    // 技巧：從切點後方開始填補，利用 % n 達成首尾相連的環狀搜尋
-    int current_child_pos = (end + 1) % n; // 小孩放置基因的指針
-    int p2_pos = (end + 1) % n;           // 媽媽讀取基因的指針
-
-    for (int i = 0; i < n; ++i) {
-        int city_from_p2 = p2.path[p2_pos];
-        if (!visited[city_from_p2]) {
-            child.path[current_child_pos] = city_from_p2;
-            current_child_pos = (current_child_pos + 1) % n;
-        }
-        p2_pos = (p2_pos + 1) % n;
-    }
+    // 2. 繼承親代 1 的中間片段，再從切點後方環狀填入親代 2 的剩餘城市
+    // 目的：保留親代 A 的局部優良路徑結構，同時保護親代 B 的「環狀鄰接關係 (Circular Adjacency)」
+    // 依 n 分派至固定大小核心 (堆疊暫存區 + bitset 標記，無 % n 與記憶體配置)
+    // 需要雜湊時 (適應度快取或重複拒絕) 由核心一併算出，短片段直接由 p2 的雜湊增量推得
+    bool needHash = m_config.useFitnessCache || m_config.rejectDuplicates;
+    FixedKernels::crossoverOX(p1.path, p2.path, start, end, child.path, needHash ? &child.hash : nullptr, p2.hash);
 
     return child;
 }
@@ -88,129 +193,989 @@ void GASolver::mutate(Individual& ind) {
     if (Utils::getRandomDouble() < m_config.mutationRate) {
         int idx1 = Utils::getRandomInt(0, m_config.cityCount - 1);
         int idx2 = Utils::getRandomInt(0, m_config.cityCount - 1);
-        std::swap(ind.path[idx1], ind.path[idx2]);
+        // 交換並以 O(1) 增量維護路徑雜湊 (若已計算)
+        TourHash::swapCities(ind.path, idx1, idx2, ind.hash);
         evaluateIndividual(ind); // 突變後需重新評估
     }
 }
 
-Individual GASolver::selectionTournament() {
+const Individual& GASolver::selectionTournament() {
     // 錦標賽規模，通常設定為族群大小的 5% ~ 10%
     // 如果 config 沒定義，我們預設為 5
     int k = m_config.tournamentSize; 
     
-    // 先隨機選一個作為目前最強的基準
+    // 先隨機選一個作為目前最強的基準 (只追蹤索引，不複製路徑)
     int bestIdx = Utils::getRandomInt(0, m_population.size() - 1);
-    Individual best = m_population[bestIdx];
 
     // 進行 k-1 次抽樣比較
     for (int i = 1; i < k; ++i) {
         int randIdx = Utils::getRandomInt(0, m_population.size() - 1);
         // 如果抽到更強的（距離更短），就更新最佳者
-        if (m_population[randIdx].distance < best.distance) {
-            best = m_population[randIdx];
+        if (m_population[randIdx].distance < m_population[bestIdx].distance) {
+            bestIdx = randIdx;
         }
     }
 
-    return best; 
+    return m_population[bestIdx]; 
+}
+
+const Individual& GASolver::selectParent() {
+    switch (m_config.selectionMode) {
+    case SelectionMode::Rank: {
+        // 線性排名：名次 r 的機率密度正比於 P - r，以反函數取樣 r = floor(P (1 - sqrt(1 - u)))
+        int popSize = static_cast<int>(m_rankKeys.size());
+        double u = Utils::getRandomDouble();
+        int r = std::min(popSize - 1, static_cast<int>(popSize * (1.0 - std::sqrt(1.0 - u))));
+        return m_population[m_rankKeys[r].second];
+    }
+    case SelectionMode::StochasticUniversal: {
+        // 親代已於 prepareSelection() 一次抽出，各執行緒以原子遊標依序領取
+        std::size_t slot = m_selectionCursor.fetch_add(1, std::memory_order_relaxed);
+        return m_population[m_selectionPool[slot % m_selectionPool.size()]];
+    }
+    default:
+        return selectionTournament();
+    }
+}
+
+void GASolver::rankPopulation(int topK) {
+    int popSize = static_cast<int>(m_population.size());
+    topK = std::max(1, std::min(topK, popSize));
+
+    // 1. 最佳個體移至索引 0 (getBestIndividual() 與拋光流程依賴此約定)
+    int bestIdx = 0;
+    for (int i = 1; i < popSize; ++i) {
+        if (m_population[i].distance < m_population[bestIdx].distance) bestIdx = i;
+    }
+    std::swap(m_population[0], m_population[bestIdx]);
+
+    // 2. 建立 (距離, 索引) 鍵陣列；距離相同時索引較小者優先，故最佳者恆排在第 0 名
+    m_rankKeys.resize(popSize);
+    for (int i = 0; i < popSize; ++i) {
+        m_rankKeys[i] = {m_population[i].distance, i};
+    }
+
+    // 線性排名需要每個個體的名次：排序 16 bytes 的鍵，而非搬動整個個體
+    if (m_config.selectionMode == SelectionMode::Rank) {
+        std::sort(m_rankKeys.begin(), m_rankKeys.end());
+        return;
+    }
+
+    // 3. 只需前 topK 名有序：O(P) 的 nth_element 加上 O(k log k) 的前段排序
+    unsigned int numThreads = m_config.threadCount ? m_config.threadCount : std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 2; // 保底機制
+    auto first = m_rankKeys.begin();
+    if (m_config.useParallel && numThreads > 1 && popSize >= kParallelRankThreshold) {
+        // 各執行緒在自己的分段內取出前 topK 名，再將候選者集中到陣列前端合併
+        int batchSize = (popSize + numThreads - 1) / numThreads;
+        std::vector<std::future<void>> futures;
+        for (int start = 0; start < popSize; start += batchSize) {
+            int end = std::min(popSize, start + batchSize);
+            futures.push_back(std::async(std::launch::async, [first, start, end, topK]() {
+                std::nth_element(first + start, first + std::min(end, start + topK), first + end);
+            }));
+        }
+        for (auto& f : futures) {
+            f.get();
+        }
+
+        // 交換集中候選者：寫入位置永遠不超過目前分段起點，不會覆寫尚未處理的候選者
+        int candidates = 0;
+        for (int start = 0; start < popSize; start += batchSize) {
+            int take = std::min(topK, std::min(popSize, start + batchSize) - start);
+            for (int j = 0; j < take; ++j) {
+                std::swap(m_rankKeys[candidates++], m_rankKeys[start + j]);
+            }
+        }
+        std::nth_element(first, first + topK, first + candidates);
+    } else {
+        std::nth_element(first, first + topK, m_rankKeys.end());
+    }
+    std::sort(first, first + topK);
+}
+
+void GASolver::prepareSelection(int count) {
+    m_selectionCursor.store(0, std::memory_order_relaxed);
+    if (m_config.selectionMode != SelectionMode::StochasticUniversal) return;
+
+    // 視窗化適應度：w_i = maxD - d_i + (maxD - minD) / P，最差個體仍保有少量被選中的機會
+    int popSize = static_cast<int>(m_population.size());
+    double minDist = m_population[0].distance;
+    double maxDist = minDist;
+    for (const auto& ind : m_population) {
+        minDist = std::min(minDist, ind.distance);
+        maxDist = std::max(maxDist, ind.distance);
+    }
+    double baseline = maxDist > minDist ? (maxDist - minDist) / popSize : 1.0;
+    double total = 0.0;
+    for (const auto& ind : m_population) {
+        total += maxDist - ind.distance + baseline;
+    }
+
+    // 單一隨機起點、間距 total / count 的等距指標，一次走訪即抽出全部親代
+    count = std::max(1, count);
+    double step = total / count;
+    double pointer = Utils::getRandomDouble(0.0, step);
+    double cumulative = 0.0;
+    m_selectionPool.clear();
+    m_selectionPool.reserve(count);
+    for (int i = 0; i < popSize && static_cast<int>(m_selectionPool.size()) < count; ++i) {
+        cumulative += maxDist - m_population[i].distance + baseline;
+        while (pointer < cumulative && static_cast<int>(m_selectionPool.size()) < count) {
+            m_selectionPool.push_back(i);
+            pointer += step;
+        }
+    }
+    while (static_cast<int>(m_selectionPool.size()) < count) {
+        m_selectionPool.push_back(0); // 浮點捨入誤差的保底
+    }
+
+    // SUS 的輸出依索引排列，打亂後再配對，避免相鄰親代總是彼此交配
+    Utils::shuffle(m_selectionPool.begin(), m_selectionPool.end());
 }
 
 Individual GASolver::solve() {
+    m_solveStart = std::chrono::steady_clock::now();
+
+    // 0. 小型實例：位元遮罩 DP 在毫秒內即可給出可證明的最佳解，無需演化
+    if (useExactSolver()) {
+        return solveExact();
+    }
+
     // 1. 初始化族群並完成第一代評估
     initPopulation(); 
 
+    // 2. 演化
+    return evolve(m_config.generations);
+}
+
+Individual GASolver::resolve(const InstanceDelta& delta, int generations) {
+    m_solveStart = std::chrono::steady_clock::now();
+    bool warm = static_cast<int>(m_population.size()) == m_config.populationSize;
+
+    std::vector<int> oldToNew, reinsert;
+    applyDelta(delta, oldToNew, reinsert);
+
+    if (useExactSolver()) {
+        return solveExact();
+    }
+    if (!warm) {
+        initPopulation();
+    } else {
+        // 修補既有族群 (各個體互不相依，沿用初始化的分批平行方式；修補後的路徑同樣由負責評估的節點寫入)
+        auto repairRange = [this, &oldToNew, &reinsert](int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                repairPath(m_population[i].path, oldToNew, reinsert);
+                m_population[i].hash = 0;
+            }
+        };
+
+        int popSize = static_cast<int>(m_population.size());
+        if (m_config.useParallel && popSize > m_config.parallelThreshold) {
+            unsigned int numThreads = m_evaluator.workerCount();
+            std::vector<std::future<void>> futures;
+            for (unsigned int worker = 0; worker < numThreads; ++worker) {
+                std::pair<int, int> range = ParallelEvaluator::batchRange(popSize, numThreads, worker);
+                if (range.first >= range.second) continue;
+                futures.push_back(std::async(std::launch::async, [this, &repairRange, range, worker]() {
+                    if (m_config.numaAware) {
+                        NumaTopology::pinCurrentThread(m_topology.cpuForWorker(worker));
+                    }
+                    repairRange(range.first, range.second);
+                }));
+            }
+            for (auto& f : futures) {
+                f.get();
+            }
+        } else {
+            repairRange(0, popSize);
+        }
+        m_evaluator.evaluate(m_population, m_instance->distances(), m_config.cityCount, m_config.useParallel, activeCache());
+    }
+
+    return evolve(generations > 0 ? generations : m_config.generations);
+}
+
+void GASolver::applyDelta(const InstanceDelta& delta, std::vector<int>& oldToNew, std::vector<int>& reinsert) {
+    const int oldN = m_config.cityCount;
+    // 實例可能與其他求解器共享：以舊實例為來源建立新實例 (寫入時複製)，舊實例保持不變；
+    // 只有本求解器持有時，矩陣直接由新實例接管
+    std::shared_ptr<const ProblemInstance> old = m_instance;
+    std::vector<City> oldCities = old->cities();
+    const std::vector<double>& oldMatrix = old->distances();
+    const std::vector<int>& cityOrder = old->cityOrder();
+    auto external = [&cityOrder](int internal) { return cityOrder.empty() ? internal : cityOrder[internal]; };
+
+    // 1. 驗證並標記移除 / 移動的城市 (外部索引)
+    std::vector<char> removed(oldN, 0), moved(oldN, 0);
+    for (int r : delta.removed) {
+        if (r < 0 || r >= oldN || removed[r]) {
+            throw std::runtime_error("InstanceDelta: invalid or duplicate removed index " + std::to_string(r));
+        }
+        removed[r] = 1;
+    }
+    for (const City& c : delta.moved) {
+        if (c.id < 0 || c.id >= oldN || removed[c.id]) {
+            throw std::runtime_error("InstanceDelta: invalid moved index " + std::to_string(c.id));
+        }
+        moved[c.id] = 1;
+    }
+    int keptCount = oldN - static_cast<int>(delta.removed.size());
+    int newN = keptCount + static_cast<int>(delta.added.size());
+    if (newN < 1) {
+        throw std::runtime_error("InstanceDelta removes every city.");
+    }
+
+    // 保留城市的新外部索引：依原順序緊密編號
+    std::vector<int> externalMap(oldN, -1);
+    for (int e = 0, next = 0; e < oldN; ++e) {
+        if (!removed[e]) externalMap[e] = next++;
+    }
+    std::vector<int> internalOf(oldN);
+    for (int i = 0; i < oldN; ++i) internalOf[external(i)] = i;
+    for (const City& c : delta.moved) {
+        oldCities[internalOf[c.id]].x = c.x;
+        oldCities[internalOf[c.id]].y = c.y;
+    }
+
+    // 2. 新的內部城市順序：保留者依舊內部順序，新增者接在最後
+    std::vector<City> cities;
+    std::vector<int> order;
+    cities.reserve(newN);
+    oldToNew.assign(oldN, -1);
+    reinsert.clear();
+    for (int i = 0; i < oldN; ++i) {
+        int e = external(i);
+        if (removed[e]) continue;
+        oldToNew[i] = static_cast<int>(cities.size());
+        if (moved[e]) reinsert.push_back(oldToNew[i]);
+        cities.push_back(oldCities[i]);
+        cities.back().id = oldToNew[i];
+        order.push_back(externalMap[e]);
+    }
+    for (std::size_t a = 0; a < delta.added.size(); ++a) {
+        int idx = static_cast<int>(cities.size());
+        cities.push_back(delta.added[a]);
+        cities.back().id = idx;
+        order.push_back(keptCount + static_cast<int>(a));
+        reinsert.push_back(idx);
+    }
+
+    // 3. 距離矩陣：未變動的元素直接搬移，只重算變動城市的列與欄
+    auto dist = [&cities](int a, int b) {
+        double dx = cities[a].x - cities[b].x;
+        double dy = cities[a].y - cities[b].y;
+        return std::sqrt(dx * dx + dy * dy);
+    };
+    std::vector<char> dirty(newN, 0);
+    for (int c : reinsert) dirty[c] = 1;
+
+    std::vector<double> matrix;
+    if (!delta.removed.empty() || !delta.added.empty()) {
+        std::vector<int> newToOld(newN, -1);
+        for (int i = 0; i < oldN; ++i) {
+            if (oldToNew[i] >= 0) newToOld[oldToNew[i]] = i;
+        }
+        matrix.resize(static_cast<std::size_t>(newN) * newN);
+        if (m_config.useHugePages) HugePageArena::advise(matrix.data(), matrix.size() * sizeof(double));
+        for (int i = 0; i < keptCount; ++i) {
+            const double* src = &oldMatrix[static_cast<std::size_t>(newToOld[i]) * oldN];
+            double* dst = &matrix[static_cast<std::size_t>(i) * newN];
+            for (int j = 0; j < keptCount; ++j) dst[j] = src[newToOld[j]];
+        }
+    } else {
+        // 只有移動：本求解器是舊實例唯一的持有者時直接接管矩陣，只覆寫變動的列與欄 ($O(kn)$)；
+        // 舊實例仍被其他求解器使用時才複製
+        m_instance.reset();
+        matrix = ProblemInstance::takeDistances(old);
+    }
+    for (int c : reinsert) {
+        for (int j = 0; j < newN; ++j) {
+            double d = (c == j) ? 0.0 : dist(c, j);
+            matrix[static_cast<std::size_t>(c) * newN + j] = d;
+            matrix[static_cast<std::size_t>(j) * newN + c] = d;
+        }
+    }
+    if (cityOrder.empty()) order.clear();
+    m_config.cityCount = newN;
+
+    // 4. 近鄰清單：清單內含失效城市或自身變動者重建，其餘只檢查變動城市能否擠進清單
+    //    (舊實例尚未建立清單時留空，由新實例在第一次取用時完整建立)
+    std::vector<std::vector<int>> lists;
+    const int k = ProblemInstance::kNeighborCount;
+    if (newN >= m_config.neighborListThreshold && old->hasNeighbors() && newN > k) {
+        const std::vector<std::vector<int>>& oldLists = old->neighbors();
+        lists.resize(newN);
+        auto row = [&matrix, newN](int a) { return &matrix[static_cast<std::size_t>(a) * newN]; };
+        std::vector<int> others;
+        for (int i = 0; i < oldN; ++i) {
+            int ni = oldToNew[i];
+            if (ni < 0) continue;
+            bool rebuild = dirty[ni];
+            for (int c : oldLists[i]) {
+                if (oldToNew[c] < 0 || dirty[oldToNew[c]]) rebuild = true;
+            }
+            if (!rebuild) {
+                for (int c : oldLists[i]) lists[ni].push_back(oldToNew[c]);
+            }
+        }
+        for (int i = 0; i < newN; ++i) {
+            const double* r = row(i);
+            if (lists[i].empty() || static_cast<int>(lists[i].size()) < k) {
+                // 完整重建 (O(n log k))
+                others.clear();
+                for (int j = 0; j < newN; ++j) {
+                    if (j != i) others.push_back(j);
+                }
+                std::partial_sort(others.begin(), others.begin() + k, others.end(),
+                                  [r](int a, int b) { return r[a] < r[b]; });
+                lists[i].assign(others.begin(), others.begin() + k);
+                continue;
+            }
+            // 僅檢查變動城市 (O(k))
+            for (int c : reinsert) {
+                if (c == i || r[c] >= r[lists[i].back()]) continue;
+                if (std::find(lists[i].begin(), lists[i].end(), c) != lists[i].end()) continue;
+                lists[i].back() = c;
+                for (int p = k - 1; p > 0 && r[lists[i][p]] < r[lists[i][p - 1]]; --p) {
+                    std::swap(lists[i][p], lists[i][p - 1]);
+                }
+            }
+        }
+    }
+    m_instance = ProblemInstance::adopt(std::move(cities), std::move(order), std::move(matrix), std::move(lists),
+                                        m_config.useHugePages);
+
+    // 5. 距離已變動：快取、拋光紀錄與 NUMA 複本全部失效
+    m_cache.clear();
+    m_lastPolishedHash = 0;
+    m_hashCounts.clear();
+    if (m_config.numaAware) {
+        buildNodeReplicas();
+        std::vector<const std::vector<double>*> replicas;
+        for (const auto& r : m_distReplicas) {
+            replicas.push_back(&r);
+        }
+        m_evaluator.setPlacement(&m_topology, std::move(replicas));
+    }
+}
+
+void GASolver::repairPath(std::vector<int>& path, const std::vector<int>& oldToNew,
+                          const std::vector<int>& reinsert) const {
+    const int n = m_config.cityCount;
+    auto d = [this, n](int a, int b) { return m_instance->distances()[static_cast<std::size_t>(a) * n + b]; };
+
+    // 重新編號並刪除失效 (移除或移動) 的城市
+    std::vector<char> pending(n, 0);
+    for (int c : reinsert) pending[c] = 1;
+    std::vector<int> repaired;
+    repaired.reserve(n);
+    for (int c : path) {
+        int nc = oldToNew[c];
+        if (nc >= 0 && !pending[nc]) repaired.push_back(nc);
+    }
+
+    // 最便宜插入：每個城市放到增加距離最少的邊上
+    for (int c : reinsert) {
+        int m = static_cast<int>(repaired.size());
+        if (m < 2) {
+            repaired.push_back(c);
+            continue;
+        }
+        int bestPos = 0;
+        double bestCost = std::numeric_limits<double>::max();
+        for (int i = 0; i < m; ++i) {
+            int a = repaired[i], b = repaired[(i + 1) % m];
+            double cost = d(a, c) + d(c, b) - d(a, b);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestPos = i + 1;
+            }
+        }
+        repaired.insert(repaired.begin() + bestPos, c);
+    }
+    path = std::move(repaired);
+}
+
+std::vector<City> GASolver::getCities() const {
+    return m_instance->originalCities();
+}
+
+bool GASolver::useExactSolver() const {
+    int n = m_config.cityCount;
+    return n <= m_config.exactThreshold && n <= ExactSolver::kMaxCities;
+}
+
+Individual GASolver::solveExact() {
+    Individual best = ExactSolver::solve(m_instance->distances(), m_config.cityCount, m_config.useParallel);
+    m_population.assign(1, best);
+    m_lowerBound = best.distance;
+    if (m_config.onBestImproved) {
+        m_config.onBestImproved(0, toOriginalIds(best));
+    }
+    if (m_config.onGenerationComplete) {
+        m_config.onGenerationComplete(0, best.distance);
+    }
+    return toOriginalIds(best);
+}
+
+Individual GASolver::evolve(int generations) {
+    m_reportedBest = std::numeric_limits<double>::max();
+
+    // 背景啟動 Held-Karp 下界，以目前族群最佳距離作為起始上界
+    m_lowerBound = 0.0;
+    m_bound.reset();
+    if (m_config.computeLowerBound || m_config.targetGap > 0.0) {
+        double initialBest = std::min_element(m_population.begin(), m_population.end())->distance;
+        m_bound = std::make_unique<HeldKarpBound>(m_instance->distances(), m_config.cityCount);
+        m_bound->start(initialBest);
+    }
+
+    Individual bestEver = m_config.steadyState ? solveSteadyState(generations)
+                        : m_config.pipelined ? solvePipelined(generations)
+                        : solveGenerational(generations);
+
+    if (m_bound) {
+        m_lowerBound = m_bound->finish();
+        m_bound.reset();
+    }
+    return toOriginalIds(bestEver);
+}
+
+Individual GASolver::toOriginalIds(Individual ind) const {
+    const std::vector<int>& cityOrder = m_instance->cityOrder();
+    if (cityOrder.empty()) return ind;
+    for (int& city : ind.path) {
+        city = cityOrder[city];
+    }
+    ind.hash = 0; // 雜湊依城市編號計算，換回原編號後需重新計算
+    return ind;
+}
+
+bool GASolver::reachedTargetGap(double bestDistance) {
+    if (!m_bound) return false;
+    m_bound->updateUpperBound(bestDistance);
+    if (m_config.targetGap <= 0.0) return false;
+    return HeldKarpBound::gap(bestDistance, m_bound->bestBound()) <= m_config.targetGap;
+}
+
+bool GASolver::shouldStop(double bestDistance) {
+    // 先回報上界給背景下界計算，再檢查取消與時間
+    if (reachedTargetGap(bestDistance)) return true;
+    if (m_config.stopFlag && m_config.stopFlag->load(std::memory_order_relaxed)) return true;
+    if (m_config.timeLimitSeconds <= 0.0) return false;
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_solveStart).count();
+    return elapsed >= m_config.timeLimitSeconds;
+}
+
+void GASolver::updateBest(int gen, Individual& bestEver, const Individual& candidate) {
+    // 同一條迴路經 2-Opt 增益扣減或換個起點重新加總，距離可能只差捨入誤差，不算改善
+    if (candidate.distance < bestEver.distance * (1.0 - 1e-12)) {
+        bestEver = candidate;
+    }
+    if (m_config.onBestImproved && bestEver.distance < m_reportedBest) {
+        m_reportedBest = bestEver.distance;
+        m_config.onBestImproved(gen, toOriginalIds(bestEver));
+    }
+}
+
+double GASolver::getOptimalityGap() const {
+    if (m_population.empty()) return HeldKarpBound::gap(0.0, 0.0);
+    return HeldKarpBound::gap(m_population[0].distance, m_lowerBound);
+}
+
+Individual GASolver::solveGenerational(int generations) {
+    // 精英保留 (5%)
+    int elitismCount = std::max(1, (int)(m_config.populationSize * 0.05));
+    int parentCount = 2 * std::max(0, m_config.populationSize - elitismCount);
+
     // 初始化 bestEver 為第一代中的最強者
-    // (因為 initPopulation 最後已經呼叫過 evaluate，所以這裡可以安全排序)
-    std::sort(m_population.begin(), m_population.end());
+    // (因為 initPopulation 最後已經呼叫過 evaluate，所以這裡可以安全排名)
+    rankPopulation(elitismCount);
+    prepareSelection(parentCount);
     Individual bestEver = m_population[0];
 
-    for (int gen = 0; gen < m_config.generations; ++gen) {
+    // 下一代緩衝區跨世代重複使用；NUMA 感知時依評估器的批次切分，由綁定到對應 CPU 的 worker 複製精英並產生子代，
+    // 新路徑因此由之後評估它的節點首次寫入 (其餘情況維持在呼叫端序列繁衍，重複檢查涵蓋整個族群)
+    int popSize = m_config.populationSize;
+    bool pinned = m_config.numaAware && m_config.useParallel && popSize > m_config.parallelThreshold;
+    unsigned int batches = pinned ? m_evaluator.workerCount() : 1;
+    std::vector<Individual> nextPopulation(popSize);
+    std::vector<std::uint64_t> eliteHashes;
+
+    for (int gen = 0; gen < generations; ++gen) {
         
         // --- A. 產生下一代 ---
-        std::vector<Individual> nextPopulation;
-        nextPopulation.reserve(m_config.populationSize);
-
-        // 精英保留 (5%)
-        int elitismCount = std::max(1, (int)(m_config.populationSize * 0.05));
-        for (int i = 0; i < elitismCount; ++i) {
-            nextPopulation.push_back(m_population[i]);
+        eliteHashes.clear();
+        if (m_config.rejectDuplicates) {
+            for (int i = 0; i < elitismCount; ++i) {
+                Individual& elite = m_population[m_rankKeys[i].second];
+                ensureHash(elite);
+                eliteHashes.push_back(elite.hash);
+            }
         }
 
-        // 繁衍 (Crossover & Mutation)
-        while (nextPopulation.size() < static_cast<size_t>(m_config.populationSize)) {
-            Individual p1 = selectionTournament();
-            Individual p2 = selectionTournament();
-            Individual child = crossoverOX(p1, p2);
-            mutate(child);
-            nextPopulation.push_back(child);
+        // 精英依鍵陣列的名次複製，族群本身不需排序；其餘位置繁衍 (Crossover & Mutation)
+        auto breedBatch = [this, &nextPopulation, &eliteHashes, popSize, batches, elitismCount, pinned](unsigned int w) {
+            std::pair<int, int> range = ParallelEvaluator::batchRange(popSize, batches, w);
+            if (range.first >= range.second) return;
+            if (pinned) {
+                NumaTopology::pinCurrentThread(m_topology.cpuForWorker(w));
+            }
+            int eliteEnd = std::max(range.first, std::min(range.second, elitismCount));
+            for (int i = range.first; i < eliteEnd; ++i) {
+                nextPopulation[i] = m_population[m_rankKeys[i].second];
+            }
+            breedInto(nextPopulation.data() + eliteEnd, range.second - eliteEnd, eliteHashes);
+        };
+        if (pinned) {
+            // 每個批次 (含第 0 批) 都交給 worker，呼叫端執行緒的 CPU 親和性不受影響
+            std::vector<std::future<void>> futures;
+            for (unsigned int w = 0; w < batches; ++w) {
+                futures.push_back(std::async(std::launch::async, breedBatch, w));
+            }
+            for (auto& f : futures) {
+                f.get();
+            }
+        } else {
+            breedBatch(0);
         }
 
         // --- B. 族群更迭 ---
-        m_population = std::move(nextPopulation);
+        m_population.swap(nextPopulation);
 
         // --- C. 統一平行評估 ---
         // 這裡負責計算這一代所有新小孩的距離
-        m_evaluator.evaluate(m_population, m_distMatrix, m_config.cityCount, m_config.useParallel);
+        m_evaluator.evaluate(m_population, m_instance->distances(), m_config.cityCount, m_config.useParallel, activeCache());
+
+        // 額外的 Memetic 強度：隨機抽選子代進行 2-Opt (於排序前，使改良後的子代能晉升精英)
+        polishIndividuals(pickPolishTargets(m_config.localSearchCount - 1));
 
-        // --- D. 排序與記錄 ---
-        std::sort(m_population.begin(), m_population.end());
+        // --- D. 排名與記錄 (只排序精英的鍵，個體留在原位) ---
+        rankPopulation(elitismCount);
 
         // 【新增：Memetic 優化】對當代最強者進行 2-Opt 拋光
         // 這樣可以確保傳入下一代的精英是經過局部微調後的完美版本
-        apply2Opt(m_population[0]);
+        polishBest(m_population[0]);
+        m_rankKeys[0].first = m_population[0].distance; // 拋光只會變短，仍為第 0 名
+        prepareSelection(parentCount);
 
-        if (m_population[0].distance < bestEver.distance) {
-            bestEver = m_population[0];
-        }
+        updateBest(gen, bestEver, m_population[0]);
         // 呼叫 Callback，讓外部決定要做什麼
         if (m_config.onGenerationComplete) {
             m_config.onGenerationComplete(gen, bestEver.distance);
         }
+
+        // 已證明足夠接近最佳解，或已用完時間預算：提前結束
+        if (shouldStop(bestEver.distance)) break;
+    }
+
+    return bestEver;
+}
+
+Individual GASolver::solvePipelined(int generations) {
+    int popSize = m_config.populationSize;
+    int elitismCount = std::max(1, (int)(popSize * 0.05));
+    int chunkSize = std::max(1, m_config.pipelineChunkSize);
+    int chunkCount = (popSize - elitismCount + chunkSize - 1) / chunkSize;
+    unsigned int numThreads = m_config.threadCount ? m_config.threadCount : std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 2; // 保底機制
+    int workers = m_config.useParallel ? std::min<int>(numThreads, chunkCount) : 1;
+    double polishProbability = std::max(0, m_config.localSearchCount - 1) /
+                               static_cast<double>(std::max(1, popSize - elitismCount));
+
+    // 只需要精英有序 (索引 0 為最佳)，其餘個體僅供親代選擇抽樣
+    int parentCount = 2 * (popSize - elitismCount);
+    rankPopulation(elitismCount);
+    prepareSelection(parentCount);
+    Individual bestEver = m_population[0];
+
+    std::vector<Individual> next(popSize);
+    std::vector<std::uint64_t> eliteHashes;
+    int gen = 0;
+    for (; gen < generations; ++gen) {
+        // --- A. 上一代最佳個體的 2-Opt 拋光，與本代繁衍同時進行 ---
+        Individual elite = m_population[0];
+        std::future<void> polishTask = std::async(workers > 1 ? std::launch::async : std::launch::deferred,
+                                                  [this, &elite]() { polishBest(elite); });
+
+        eliteHashes.clear();
+        for (int i = 0; i < elitismCount; ++i) {
+            next[i] = m_population[m_rankKeys[i].second];
+            if (m_config.rejectDuplicates) {
+                ensureHash(next[i]);
+                eliteHashes.push_back(next[i].hash);
+            }
+        }
+
+        // --- B. 融合任務：選擇 → 交叉 → 突變 → 評估 → (選擇性) 拋光 ---
+        // 工作者以原子計數器領取區塊，先完成的執行緒自動承接剩餘區塊
+        std::atomic<int> nextChunk{0};
+        auto worker = [this, &next, &nextChunk, &eliteHashes, chunkCount, chunkSize, elitismCount, popSize, polishProbability]() {
+            for (int c = nextChunk++; c < chunkCount; c = nextChunk++) {
+                int start = elitismCount + c * chunkSize;
+                breedChunk(next, start, std::min(popSize, start + chunkSize), polishProbability, eliteHashes);
+            }
+        };
+        std::vector<std::future<void>> futures;
+        for (int w = 1; w < workers; ++w) {
+            futures.push_back(std::async(std::launch::async, worker));
+        }
+        worker();
+        for (auto& f : futures) {
+            f.get();
+        }
+        polishTask.get();
+        next[0] = std::move(elite);
+
+        // --- C. 族群更迭與精英排名 ---
+        m_population.swap(next);
+        rankPopulation(elitismCount);
+        prepareSelection(parentCount);
+
+        updateBest(gen, bestEver, m_population[0]);
+        if (m_config.onGenerationComplete) {
+            m_config.onGenerationComplete(gen, bestEver.distance);
+        }
+        if (shouldStop(bestEver.distance)) break;
     }
 
+    // 最後一代的最佳個體尚未經過拋光
+    polishBest(m_population[0]);
+    updateBest(std::min(gen, generations - 1), bestEver, m_population[0]);
     return bestEver;
 }
 
+void GASolver::breedInto(Individual* out, int count, const std::vector<std::uint64_t>& eliteHashes) {
+    std::unordered_map<std::uint64_t, int> seen;
+    if (m_config.rejectDuplicates) {
+        for (std::uint64_t h : eliteHashes) seen[h]++;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        const Individual& p1 = selectParent();
+        const Individual& p2 = selectParent();
+        Individual child = crossoverOX(p1, p2);
+        mutate(child);
+
+        if (m_config.rejectDuplicates) {
+            // 重複路徑：以強制交換擾動最多數次，仍重複則照常收下以免卡住繁衍
+            ensureHash(child);
+            for (int attempt = 0; attempt < 3 && seen.count(child.hash); ++attempt) {
+                int idx1 = Utils::getRandomInt(0, m_config.cityCount - 1);
+                int idx2 = Utils::getRandomInt(0, m_config.cityCount - 1);
+                TourHash::swapCities(child.path, idx1, idx2, child.hash);
+            }
+            seen[child.hash]++;
+        }
+        out[i] = std::move(child);
+    }
+}
+
+void GASolver::breedChunk(std::vector<Individual>& next, int begin, int end, double polishProbability,
+                          const std::vector<std::uint64_t>& eliteHashes) {
+    // 跨區塊的重複不檢查，以免任務間同步
+    std::vector<Individual> chunk(end - begin);
+    breedInto(chunk.data(), end - begin, eliteHashes);
+
+    // 整個區塊在本執行緒上序列評估，避免巢狀平行
+    m_evaluator.evaluate(chunk, m_instance->distances(), m_config.cityCount, false, activeCache());
+
+    for (int i = begin; i < end; ++i) {
+        Individual& child = chunk[i - begin];
+        if (polishProbability > 0.0 && Utils::getRandomDouble() < polishProbability) {
+            apply2Opt(child);
+            child.fitness = 1.0 / (child.distance + 1.0);
+        }
+        next[i] = std::move(child);
+    }
+}
+
+Individual GASolver::solveSteadyState(int generations) {
+    m_heap.build(m_population);
+    Individual bestEver = m_population[m_heap.minIndex()];
+
+    m_hashCounts.clear();
+    if (m_config.rejectDuplicates) {
+        for (auto& ind : m_population) {
+            ensureHash(ind);
+            m_hashCounts[ind.hash]++;
+        }
+    }
+
+    // 每「代」產生的子代數與世代模式相同，使兩種模式的 generations 具可比性
+    int elitismCount = std::max(1, (int)(m_config.populationSize * 0.05));
+    int offspringPerGen = std::max(1, m_config.populationSize - elitismCount);
+    int batchSize = std::max(1, m_config.steadyStateBatchSize);
+
+    std::vector<Individual> batch;
+    batch.reserve(batchSize);
+
+    for (int gen = 0; gen < generations; ++gen) {
+        int produced = 0;
+        while (produced < offspringPerGen) {
+            int count = std::min(batchSize, offspringPerGen - produced);
+
+            // --- A. 批次繁衍：同一批子代的親代皆取自插入前的族群 ---
+            batch.clear();
+            // 堆積只維護最佳 / 最差者而無全域名次，親代選擇固定使用錦標賽
+            for (int i = 0; i < count; ++i) {
+                const Individual& p1 = selectionTournament();
+                const Individual& p2 = selectionTournament();
+                Individual child = crossoverOX(p1, p2);
+                mutate(child);
+                batch.push_back(std::move(child));
+            }
+
+            // --- B. 批次平行評估 ---
+            m_evaluator.evaluate(batch, m_instance->distances(), m_config.cityCount, m_config.useParallel, activeCache());
+
+            // --- C. 逐一插入：僅在子代優於被取代者時覆寫槽位，O(log P) ---
+            for (auto& child : batch) {
+                int victim = (m_config.replacement == ReplacementPolicy::Worst)
+                                 ? m_heap.maxIndex()
+                                 : selectTournamentLoser();
+                if (child.distance >= m_population[victim].distance) continue;
+
+                if (m_config.rejectDuplicates) {
+                    // 族群中已存在相同迴路：拒絕插入以維持多樣性
+                    ensureHash(child);
+                    if (m_hashCounts[child.hash] > 0) continue;
+                    if (--m_hashCounts[m_population[victim].hash] == 0) {
+                        m_hashCounts.erase(m_population[victim].hash);
+                    }
+                    m_hashCounts[child.hash]++;
+                }
+                m_population[victim] = std::move(child);
+                m_heap.update(victim, m_population[victim].distance);
+            }
+            produced += count;
+        }
+
+        // --- D. Memetic 優化：隨機子集 2-Opt，再對當前最佳個體進行拋光 ---
+        std::vector<int> targets = pickPolishTargets(m_config.localSearchCount - 1);
+        std::vector<std::uint64_t> oldHashes;
+        for (int idx : targets) oldHashes.push_back(m_population[idx].hash);
+        polishIndividuals(targets);
+        for (std::size_t t = 0; t < targets.size(); ++t) {
+            int idx = targets[t];
+            m_heap.update(idx, m_population[idx].distance);
+            if (m_config.rejectDuplicates && m_population[idx].hash != oldHashes[t]) {
+                if (--m_hashCounts[oldHashes[t]] == 0) m_hashCounts.erase(oldHashes[t]);
+                m_hashCounts[m_population[idx].hash]++;
+            }
+        }
+        int bestIdx = m_heap.minIndex();
+        std::uint64_t beforeHash = m_population[bestIdx].hash;
+        polishBest(m_population[bestIdx]);
+        m_heap.update(bestIdx, m_population[bestIdx].distance);
+        if (m_config.rejectDuplicates && m_population[bestIdx].hash != beforeHash) {
+            if (--m_hashCounts[beforeHash] == 0) m_hashCounts.erase(beforeHash);
+            m_hashCounts[m_population[bestIdx].hash]++;
+        }
+
+        updateBest(gen, bestEver, m_population[bestIdx]);
+        if (m_config.onGenerationComplete) {
+            m_config.onGenerationComplete(gen, bestEver.distance);
+        }
+        if (shouldStop(bestEver.distance)) break;
+    }
+
+    // 維持 getBestIndividual() 的約定：最佳個體位於索引 0
+    std::swap(m_population[0], m_population[m_heap.minIndex()]);
+    m_heap.build(m_population);
+
+    return bestEver;
+}
+
+int GASolver::selectTournamentLoser() {
+    int k = m_config.tournamentSize;
+    int worstIdx = Utils::getRandomInt(0, m_population.size() - 1);
+
+    for (int i = 1; i < k; ++i) {
+        int randIdx = Utils::getRandomInt(0, m_population.size() - 1);
+        if (m_population[randIdx].distance > m_population[worstIdx].distance) {
+            worstIdx = randIdx;
+        }
+    }
+    return worstIdx;
+}
 
 Individual GASolver::getBestIndividual() const {
     if (m_population.empty()) {
         // 如果族群還是空的（還沒 init），回傳一個空的 Individual
         return Individual();
     }
-    // 傳回目前排序第一名的個體
-    return m_population[0];
+    // 傳回目前排序第一名的個體 (以原始城市編號表示)
+    return toOriginalIds(m_population[0]);
 }
 
+std::string GASolver::getMemoryPlacementReport() const {
+    std::ostringstream out;
+    out << NumaTopology::describePlacement("distMatrix", m_instance->distances().data(),
+                                           m_instance->distances().size() * sizeof(double)) << "\n";
+    for (std::size_t node = 0; node < m_distReplicas.size(); ++node) {
+        const auto& r = m_distReplicas[node];
+        out << NumaTopology::describePlacement("distMatrix[node " + std::to_string(node) + "]",
+                                               r.data(), r.size() * sizeof(double)) << "\n";
+    }
 
+    // 族群路徑各自配置，抽樣數個分散在族群中的個體
+    if (!m_population.empty()) {
+        std::size_t step = std::max<std::size_t>(1, m_population.size() / 4);
+        for (std::size_t i = 0; i < m_population.size(); i += step) {
+            const auto& path = m_population[i].path;
+            out << NumaTopology::describePlacement("population[" + std::to_string(i) + "].path",
+                                                   path.data(), path.size() * sizeof(int)) << "\n";
+        }
+    }
+    return out.str();
+}
+
+MemoryFootprint GASolver::getMemoryFootprint() const {
+    MemoryFootprint footprint;
+    footprint.distanceTable = m_instance->distances().capacity() * sizeof(double);
+    for (const auto& r : m_distReplicas) footprint.distanceTable += r.capacity() * sizeof(double);
+    footprint.distanceBacking = m_instance->distanceBacking();
+
+    if (m_instance->hasNeighbors()) {
+        const auto& lists = m_instance->neighbors();
+        footprint.neighborLists = lists.capacity() * sizeof(std::vector<int>);
+        for (const auto& list : lists) footprint.neighborLists += list.capacity() * sizeof(int);
+    }
+
+    footprint.population = m_population.capacity() * sizeof(Individual);
+    for (const auto& ind : m_population) footprint.population += ind.path.capacity() * sizeof(int);
+
+    // 配置區只計已配置的部分 (未寫入的分頁不佔實體記憶體)；未建立時改計兩個容器本身
+    if (m_arena) {
+        footprint.scratch = m_arena->used();
+    } else {
+        footprint.scratch = m_rankKeys.capacity() * sizeof(m_rankKeys[0]) + m_selectionPool.capacity() * sizeof(int);
+    }
+    footprint.scratch += static_cast<std::size_t>(m_heap.size()) * (2 * sizeof(int) + sizeof(double));
+    return footprint;
+}
+
+MemoryFootprint GASolver::estimateFootprint(const GAConfig& config) {
+    const std::size_t n = static_cast<std::size_t>(std::max(config.cityCount, 0));
+    const std::size_t popSize = static_cast<std::size_t>(std::max(config.populationSize, 0));
+    MemoryFootprint footprint;
+    footprint.distanceTable = n * n * sizeof(double);
+    if (config.cityCount >= config.neighborListThreshold) {
+        footprint.neighborLists = n * (sizeof(std::vector<int>) + ProblemInstance::kNeighborCount * sizeof(int));
+    }
+    footprint.population = 2 * popSize * (sizeof(Individual) + n * sizeof(int));
+    // 排名鍵 P 項、親代池至多 2P 項，另加兩次快取行對齊
+    footprint.scratch = popSize * sizeof(std::pair<double, int>) + 2 * popSize * sizeof(int) + 2 * 64;
+    return footprint;
+}
+
+std::string GASolver::getMemoryFootprintReport() const {
+    MemoryFootprint footprint = getMemoryFootprint();
+    auto mb = [](std::size_t bytes) { return static_cast<double>(bytes) / (1 << 20); };
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+    out << "distance table : " << mb(footprint.distanceTable) << " MB ("
+        << HugePageArena::backingName(footprint.distanceBacking) << ")\n";
+    out << "neighbor lists : " << mb(footprint.neighborLists) << " MB\n";
+    out << "population     : " << mb(footprint.population) << " MB\n";
+    out << "scratch        : " << mb(footprint.scratch) << " MB";
+    if (m_arena) out << " (arena: " << HugePageArena::backingName(m_arena->backing()) << ")";
+    out << "\n";
+    out << "total          : " << mb(footprint.total()) << " MB\n";
+    return out.str();
+}
 
 void GASolver::apply2Opt(Individual& ind) {
-    bool improved = true;
     int n = m_config.cityCount;
+    // 已知雜湊時隨每個移動以 TourHash::twoOptDelta 增量更新；未知 (0) 則維持未知
+    std::uint64_t* hash = ind.hash != 0 ? &ind.hash : nullptr;
 
-    while (improved) {
-        improved = false;
-        for (int i = 1; i < n - 2; ++i) {
-            for (int j = i + 1; j < n - 1; ++j) {
-                // 使用 1D 索引公式: row * n + col
-                int idx_i_prev = ind.path[i - 1];
-                int idx_i = ind.path[i];
-                int idx_j = ind.path[j];
-                int idx_j_next = ind.path[j + 1];
-
-                // 計算交換前的兩條邊距離
-                double oldDist = m_distMatrix[idx_i_prev * n + idx_i] + 
-                                m_distMatrix[idx_j * n + idx_j_next];
-                
-                // 計算交換後的兩條邊距離
-                double newDist = m_distMatrix[idx_i_prev * n + idx_j] + 
-                                m_distMatrix[idx_i * n + idx_j_next];
-
-                if (newDist < oldDist) {
-                    // 執行子路徑翻轉 (i 到 j 之間的部分)
-                    std::reverse(ind.path.begin() + i, ind.path.begin() + j + 1);
-                    ind.distance -= (oldDist - newDist);
-                    improved = true;
-                }
-            }
+    const auto& neighbors = neighborLists();
+    if (!neighbors.empty()) {
+        ind.distance -= LocalSearch::twoOptNeighborList(ind.path, m_instance->distances(), n, neighbors, hash);
+    } else {
+        // 全鄰域掃描：以區塊為單位批次計算移動增益 (可向量化)，套用區塊內最佳的移動
+        ind.distance -= LocalSearch::twoOptBlocked(ind.path, m_instance->distances(), n, hash);
+    }
+    if (hash && ind.hash == 0) ind.hash = TourHash::compute(ind.path); // 增量結果恰為保留值 0 時重新計算
+}
+
+std::vector<int> GASolver::pickPolishTargets(int count) {
+    int popSize = static_cast<int>(m_population.size());
+    count = std::min(count, popSize);
+    if (count <= 0) return {};
+
+    // 部分 Fisher-Yates 洗牌：抽出 count 個互不重複的索引
+    std::vector<int> indices(popSize);
+    std::iota(indices.begin(), indices.end(), 0);
+    for (int i = 0; i < count; ++i) {
+        std::swap(indices[i], indices[Utils::getRandomInt(i, popSize - 1)]);
+    }
+    indices.resize(count);
+    return indices;
+}
+
+void GASolver::polishIndividuals(const std::vector<int>& indices) {
+    if (indices.empty()) return;
+
+    // 各個體的 2-Opt 互不相依 (僅唯讀共用距離矩陣與近鄰清單)，可直接平行執行
+    auto work = [this, &indices](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; ++k) {
+            Individual& ind = m_population[indices[k]];
+            apply2Opt(ind);
+            ind.fitness = 1.0 / (ind.distance + 1.0);
         }
+    };
+
+    unsigned int numThreads = m_config.threadCount ? m_config.threadCount : std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 2; // 保底機制
+    if (!m_config.useParallel || indices.size() < 2 || numThreads == 1) {
+        work(0, indices.size());
+        return;
+    }
+
+    std::size_t batchSize = (indices.size() + numThreads - 1) / numThreads;
+    std::vector<std::future<void>> futures;
+    for (std::size_t start = 0; start < indices.size(); start += batchSize) {
+        futures.push_back(std::async(std::launch::async, work, start, std::min(indices.size(), start + batchSize)));
+    }
+    for (auto& f : futures) {
+        f.get();
+    }
+}
+
+void GASolver::polishBest(Individual& ind) {
+    ensureHash(ind);
+    if (ind.hash == m_lastPolishedHash) {
+        return; // 同一條迴路已是 2-Opt 局部最優，跳過重複拋光
+    }
+
+    if (m_config.useParallel && m_config.cityCount >= m_config.parallelPolishThreshold) {
+        // 大型單一路徑：依路徑區段切分鄰域，多核心同時套用互不衝突的改善
+        ind.distance -= LocalSearch::twoOptParallel(ind.path, m_instance->distances(), m_config.cityCount, neighborLists(),
+                                                    m_config.threadCount, &ind.hash);
+        if (ind.hash == 0) ind.hash = TourHash::compute(ind.path);
+    } else {
+        apply2Opt(ind);
     }
-}
\ No newline at end of file
+    ind.fitness = 1.0 / (ind.distance + 1.0);
+    m_lastPolishedHash = ind.hash;
+
+    if (FitnessCache* cache = activeCache()) {
+        cache->insert(ind.hash, ind.distance);
+    }
+}
+
+const std::vector<std::vector<int>>& GASolver::neighborLists() const {
+    static const std::vector<std::vector<int>> none;
+    // 大規模實例才使用近鄰 2-Opt；清單由共享實例在第一次取用時建立
+    return m_config.cityCount >= m_config.neighborListThreshold ? m_instance->neighbors() : none;
+}
+
+void GASolver::ensureHash(Individual& ind) {
+    if (ind.hash == 0) {
+        ind.hash = TourHash::compute(ind.path);
+    }
+}
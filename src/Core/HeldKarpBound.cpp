@@ -0,0 +1,195 @@
+#include "Core/HeldKarpBound.h"
+#include "Core/LocalSearch.h"
+#include "Core/TourConstructor.h"
+#include "Core/Utils.h"
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <limits>
+#include <thread>
+
+HeldKarpBound::HeldKarpBound(const std::vector<double>& distMatrix, int n)
+    : m_distMatrix(distMatrix), m_n(n), m_best(0.0), m_optimal(false), m_upper(0.0), m_stop(false) {}
+
+HeldKarpBound::~HeldKarpBound() {
+    finish();
+}
+
+void HeldKarpBound::start(double initialUpper, unsigned int chains) {
+    finish();
+    m_upper.store(initialUpper);
+    m_stop.store(false);
+    m_task = std::async(std::launch::async, [this, chains]() {
+        return run(&m_upper, &m_stop, chains);
+    });
+}
+
+void HeldKarpBound::updateUpperBound(double upper) {
+    if (upper < m_upper.load()) m_upper.store(upper);
+}
+
+double HeldKarpBound::finish() {
+    if (m_task.valid()) {
+        m_stop.store(true);
+        m_task.get();
+    }
+    return m_best.load();
+}
+
+double HeldKarpBound::run(const std::atomic<double>* upperBound,
+                          const std::atomic<bool>* stop,
+                          unsigned int chains,
+                          int maxIterations) {
+    if (m_n < 3) return 0.0;
+
+    if (chains == 0) chains = std::thread::hardware_concurrency();
+    if (chains == 0) chains = 2; // 保底機制
+    if (maxIterations <= 0) maxIterations = std::max(1000, 50 * m_n);
+
+    // 沒有外部上界時，以最近鄰居法 + 近鄰 2-Opt 估計 (約高於最佳解數個百分點)
+    double fallbackUpper = 0.0;
+    if (!upperBound) {
+        std::vector<int> path = TourConstructor::nearestNeighbor(m_distMatrix, m_n, 0.0);
+        auto neighbors = TourConstructor::buildCandidateLists(m_distMatrix, m_n, 8);
+        LocalSearch::twoOptNeighborList(path, m_distMatrix, m_n, neighbors);
+        for (int i = 0; i < m_n; ++i) {
+            fallbackUpper += m_distMatrix[static_cast<std::size_t>(path[i]) * m_n + path[(i + 1) % m_n]];
+        }
+    }
+
+    // 各鏈使用不同的初始步長與特殊節點，探索不同的次梯度軌跡
+    const double lambdas[] = {2.0, 1.0, 0.5, 0.25};
+    std::vector<std::future<void>> futures;
+    for (unsigned int c = 1; c < chains; ++c) {
+        double lambda0 = lambdas[c % 4];
+        int special = static_cast<int>((static_cast<long long>(c) * m_n) / chains);
+        futures.push_back(std::async(std::launch::async, [this, lambda0, special, fallbackUpper, upperBound, stop, maxIterations]() {
+            chain(lambda0, special, fallbackUpper, upperBound, stop, maxIterations);
+        }));
+    }
+    chain(lambdas[0], 0, fallbackUpper, upperBound, stop, maxIterations);
+    for (auto& f : futures) {
+        f.get();
+    }
+    return m_best.load();
+}
+
+void HeldKarpBound::chain(double lambda0, int special, double fallbackUpper,
+                          const std::atomic<double>* upperBound, const std::atomic<bool>* stop, int maxIterations) {
+    std::vector<double> pi(m_n, 0.0);
+    std::vector<int> degree(m_n);
+
+    double lambda = lambda0;
+    double chainBest = -std::numeric_limits<double>::max();
+    int sinceImprove = 0;
+    const int period = std::max(20, m_n / 4);
+
+    for (int iter = 0; iter < maxIterations && lambda > 1e-6; ++iter) {
+        if (m_optimal.load() || (stop && stop->load())) break;
+
+        double bound = oneTree(pi, special, degree);
+        if (bound > chainBest + 1e-12) {
+            chainBest = bound;
+            sinceImprove = 0;
+            publish(bound);
+        } else if (++sinceImprove >= period) {
+            lambda *= 0.5;
+            sinceImprove = 0;
+        }
+
+        double norm = 0.0;
+        for (int i = 0; i < m_n; ++i) {
+            double g = degree[i] - 2;
+            norm += g * g;
+        }
+        double upper = upperBound ? upperBound->load() : fallbackUpper;
+        if (norm == 0.0 || upper - bound <= 1e-9 * upper) {
+            // 1-Tree 恰為一條迴路，或下界已追上已知迴路：該迴路即為最佳解
+            m_optimal.store(true);
+            break;
+        }
+
+        double step = lambda * (upper - bound) / norm;
+        for (int i = 0; i < m_n; ++i) {
+            pi[i] += step * (degree[i] - 2);
+        }
+    }
+}
+
+double HeldKarpBound::oneTree(const std::vector<double>& pi, int special, std::vector<int>& degree) const {
+    const int n = m_n;
+    auto w = [this, &pi, n](int a, int b) {
+        return m_distMatrix[static_cast<std::size_t>(a) * n + b] + pi[a] + pi[b];
+    };
+
+    std::fill(degree.begin(), degree.end(), 0);
+    std::vector<double> key(n, std::numeric_limits<double>::max());
+    std::vector<int> parent(n, -1);
+    std::vector<char> inTree(n, 0);
+    inTree[special] = 1;
+
+    // Prim：在去掉特殊節點的完全圖上求最小生成樹，$O(n^2)$
+    int start = (special == 0) ? 1 : 0;
+    key[start] = 0.0;
+    double total = 0.0;
+    for (int k = 0; k < n - 1; ++k) {
+        int u = -1;
+        for (int v = 0; v < n; ++v) {
+            if (!inTree[v] && (u < 0 || key[v] < key[u])) u = v;
+        }
+        inTree[u] = 1;
+        total += key[u];
+        if (parent[u] >= 0) {
+            degree[u]++;
+            degree[parent[u]]++;
+        }
+        for (int v = 0; v < n; ++v) {
+            if (inTree[v]) continue;
+            double wv = w(u, v);
+            if (wv < key[v]) {
+                key[v] = wv;
+                parent[v] = u;
+            }
+        }
+    }
+
+    // 特殊節點接上最短的兩條邊
+    double first = std::numeric_limits<double>::max(), second = first;
+    int firstIdx = -1, secondIdx = -1;
+    for (int v = 0; v < n; ++v) {
+        if (v == special) continue;
+        double wv = w(special, v);
+        if (wv < first) {
+            second = first; secondIdx = firstIdx;
+            first = wv; firstIdx = v;
+        } else if (wv < second) {
+            second = wv; secondIdx = v;
+        }
+    }
+    total += first + second;
+    degree[special] = 2;
+    degree[firstIdx]++;
+    degree[secondIdx]++;
+
+    double piSum = 0.0;
+    for (double p : pi) piSum += p;
+    return total - 2.0 * piSum;
+}
+
+void HeldKarpBound::publish(double bound) {
+    double current = m_best.load();
+    while (bound > current && !m_best.compare_exchange_weak(current, bound)) {
+        // compare_exchange_weak 失敗時會把最新值寫回 current，重新比較即可
+    }
+}
+
+double HeldKarpBound::compute(const std::vector<City>& cities, unsigned int chains) {
+    std::vector<double> matrix = Utils::precomputeDistanceMatrix(cities);
+    HeldKarpBound bound(matrix, static_cast<int>(cities.size()));
+    return bound.run(nullptr, nullptr, chains);
+}
+
+double HeldKarpBound::gap(double tourLength, double lowerBound) {
+    if (lowerBound <= 0.0) return std::numeric_limits<double>::infinity();
+    return (tourLength - lowerBound) / lowerBound;
+}
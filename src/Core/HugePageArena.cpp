@@ -0,0 +1,81 @@
+#include "Core/HugePageArena.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace {
+std::size_t roundUp(std::size_t value, std::size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+}
+
+HugePageArena::HugePageArena(std::size_t capacity, bool explicitPages) {
+    m_capacity = roundUp(std::max<std::size_t>(capacity, 1), kHugePageSize);
+
+#ifdef __linux__
+#ifdef MAP_HUGETLB
+    if (explicitPages) {
+        void* p = mmap(nullptr, m_capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            m_mapping = m_base = p;
+            m_mapped = m_capacity;
+            m_backing = PageBacking::Explicit;
+            return;
+        }
+    }
+#endif
+    // 多映射一個大分頁的空間，讓起點可以對齊到 2 MB 邊界 (mmap 只保證 4 KB 對齊)
+    m_mapped = m_capacity + kHugePageSize;
+    void* p = mmap(nullptr, m_mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+    m_mapping = p;
+    m_base = reinterpret_cast<void*>(roundUp(reinterpret_cast<std::uintptr_t>(p), kHugePageSize));
+    m_backing = advise(m_base, m_capacity);
+#else
+    (void)explicitPages;
+    m_base = ::operator new(m_capacity);
+    m_backing = PageBacking::Regular;
+#endif
+}
+
+HugePageArena::~HugePageArena() {
+#ifdef __linux__
+    if (m_mapping) munmap(m_mapping, m_mapped);
+#else
+    ::operator delete(m_base);
+#endif
+}
+
+void* HugePageArena::allocate(std::size_t bytes, std::size_t alignment) {
+    std::size_t offset = roundUp(m_used, alignment);
+    if (offset > m_capacity || bytes > m_capacity - offset) return nullptr;
+    m_used = offset + bytes;
+    return static_cast<char*>(m_base) + offset;
+}
+
+PageBacking HugePageArena::advise(void* data, std::size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // 只提示完整落在範圍內的 2 MB 區塊
+    std::uintptr_t begin = roundUp(reinterpret_cast<std::uintptr_t>(data), kHugePageSize);
+    std::uintptr_t end = (reinterpret_cast<std::uintptr_t>(data) + bytes) / kHugePageSize * kHugePageSize;
+    if (end > begin && madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) == 0) {
+        return PageBacking::Transparent;
+    }
+#else
+    (void)data;
+    (void)bytes;
+#endif
+    return PageBacking::Regular;
+}
+
+const char* HugePageArena::backingName(PageBacking backing) {
+    switch (backing) {
+        case PageBacking::Explicit: return "explicit 2 MB pages";
+        case PageBacking::Transparent: return "transparent huge pages";
+        default: return "4 KB pages";
+    }
+}
@@ -0,0 +1,327 @@
+#include "Core/LocalSearch.h"
+#include "Core/TwoLevelList.h"
+#include "Core/TourHash.h"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <limits>
+#include <thread>
+
+// x86 上以函式多版本 (target 屬性) 編譯 AVX2 路徑，預設建置 (未加 -march) 也能在執行期選用
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GA_HAS_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+namespace {
+double blockGainsScalar(const double* rowA, const double* rowB, double dab,
+                        const int* path, const double* edge, int k, int len, double* gains, double best) {
+    for (; k < len; ++k) {
+        gains[k] = dab + edge[k] - rowA[path[k]] - rowB[path[k + 1]];
+        best = std::max(best, gains[k]);
+    }
+    return best;
+}
+
+#ifdef GA_HAS_AVX2_KERNEL
+__attribute__((target("avx2")))
+double blockGainsAvx2(const double* rowA, const double* rowB, double dab,
+                      const int* path, const double* edge, int len, double* gains) {
+    int k = 0;
+    const __m256d ab = _mm256_set1_pd(dab);
+    const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    __m256d vmax = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+    for (; k + 4 <= len; k += 4) {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(path + k));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(path + k + 1));
+        // 明確給定來源與全開遮罩，避免 GCC 對未初始化來源暫存器的誤報
+        __m256d ac = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), rowA, c, all, 8);
+        __m256d bd = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), rowB, d, all, 8);
+        __m256d cd = _mm256_loadu_pd(edge + k);
+        // 與純量版本相同的運算順序，結果逐位元一致
+        __m256d g = _mm256_sub_pd(_mm256_sub_pd(_mm256_add_pd(ab, cd), ac), bd);
+        _mm256_store_pd(gains + k, g);
+        vmax = _mm256_max_pd(vmax, g);
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, vmax);
+    double best = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    return blockGainsScalar(rowA, rowB, dab, path, edge, k, len, gains, best);
+}
+
+// 以 -mavx2 / -march=native 編譯時直接使用；否則在第一次呼叫時查詢 CPU 一次
+bool detectAvx2() {
+#ifdef __AVX2__
+    return true;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+}
+
+double LocalSearch::twoOptNeighborList(std::vector<int>& path,
+                                       const std::vector<double>& distMatrix,
+                                       int n,
+                                       const std::vector<std::vector<int>>& neighbors,
+                                       std::uint64_t* hash) {
+    if (n < 5) return 0.0;
+
+    auto d = [&distMatrix, n](int a, int b) { return distMatrix[static_cast<std::size_t>(a) * n + b]; };
+    const double eps = 1e-10;
+
+    TwoLevelList tour(path);
+    double totalGain = 0.0;
+
+    // 待處理佇列：只有端點變動過的城市才需要重新檢查
+    std::deque<int> queue(path.begin(), path.end());
+    std::vector<bool> queued(n, true);
+    auto push = [&queue, &queued](int c) {
+        if (!queued[c]) {
+            queued[c] = true;
+            queue.push_back(c);
+        }
+    };
+
+    while (!queue.empty()) {
+        int a = queue.front();
+        queue.pop_front();
+        queued[a] = false;
+
+        bool improved = false;
+        // 分別以 a 的後繼與前驅作為被移除的邊
+        for (int dir = 0; dir < 2 && !improved; ++dir) {
+            int b = (dir == 0) ? tour.next(a) : tour.prev(a);
+            double dab = d(a, b);
+
+            for (int c : neighbors[a]) {
+                double dac = d(a, c);
+                if (dac >= dab) break; // 近鄰清單遞增：後續候選不可能再有正增益
+                int dd = (dir == 0) ? tour.next(c) : tour.prev(c);
+                if (c == b || dd == a) continue;
+
+                double gain = dab + d(c, dd) - dac - d(b, dd);
+                if (gain > eps) {
+                    // 移除 (a,b)、(c,dd)，加入 (a,c)、(b,dd)
+                    if (dir == 0) {
+                        tour.reverse(b, c);  // a→b ... c→dd  =>  a→c ... b→dd
+                    } else {
+                        tour.reverse(a, dd); // b→a ... dd→c  =>  b→dd ... a→c
+                    }
+                    if (hash) *hash ^= TourHash::twoOptDelta(a, b, c, dd);
+                    totalGain += gain;
+                    push(a); push(b); push(c); push(dd);
+                    improved = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    path = tour.toPath();
+    return totalGain;
+}
+
+double LocalSearch::twoOptBlocked(std::vector<int>& path, const std::vector<double>& distMatrix, int n,
+                                  std::uint64_t* hash) {
+    if (n < 4) return 0.0;
+    return twoOptBlockedRange(path.data(), n, distMatrix.data(), n, hash);
+}
+
+double LocalSearch::twoOptBlockedRange(int* p, int len, const double* dist, int n, std::uint64_t* hash) {
+    if (len < 4) return 0.0;
+
+    const double eps = 1e-10;
+
+    // 邊長陣列：edge[k] = d(p[k], p[k+1])，讓 d(c, d) 成為連續讀取
+    std::vector<double> edge(len - 1);
+    for (int k = 0; k < len - 1; ++k) {
+        edge[k] = dist[static_cast<std::size_t>(p[k]) * n + p[k + 1]];
+    }
+
+    alignas(32) double gains[kBlock];
+    double totalGain = 0.0;
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (int i = 1; i < len - 2; ++i) {
+            int j0 = i + 1;
+            while (j0 < len - 1) {
+                int blockLen = std::min(kBlock, len - 1 - j0);
+                const double* rowA = dist + static_cast<std::size_t>(p[i - 1]) * n;
+                const double* rowB = dist + static_cast<std::size_t>(p[i]) * n;
+                // 絕大多數區塊沒有改善移動：先比較區塊最大值，必要時才找出位置
+                double bestGain = blockGains(rowA, rowB, edge[i - 1], p + j0, edge.data() + j0, blockLen, gains);
+                if (!(bestGain > eps)) {
+                    j0 += blockLen;
+                    continue;
+                }
+                int best = static_cast<int>(std::find(gains, gains + blockLen, bestGain) - gains);
+
+                // 翻轉 path[i..j]：內部的邊反序，兩端換成新邊 (a, c) 與 (b, d)
+                int j = j0 + best;
+                if (hash) *hash ^= TourHash::twoOptDelta(p[i - 1], p[i], p[j], p[j + 1]);
+                std::reverse(p + i, p + j + 1);
+                std::reverse(edge.begin() + i, edge.begin() + j);
+                edge[i - 1] = rowA[p[i]];
+                edge[j] = rowB[p[j + 1]];
+                totalGain += bestGain;
+                improved = true;
+
+                // path[i] 已換成 c，以新的 b 從頭掃描
+                j0 = i + 1;
+            }
+        }
+    }
+    return totalGain;
+}
+
+double LocalSearch::blockGains(const double* rowA, const double* rowB, double dab,
+                               const int* path, const double* edge, int len, double* gains) {
+#ifdef GA_HAS_AVX2_KERNEL
+    if (usesAvx2()) return blockGainsAvx2(rowA, rowB, dab, path, edge, len, gains);
+#endif
+    return blockGainsScalar(rowA, rowB, dab, path, edge, 0, len, gains, -std::numeric_limits<double>::infinity());
+}
+
+bool LocalSearch::usesAvx2() {
+#ifdef GA_HAS_AVX2_KERNEL
+    static const bool supported = detectAvx2();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+double LocalSearch::twoOptParallel(std::vector<int>& path,
+                                   const std::vector<double>& distMatrix,
+                                   int n,
+                                   const std::vector<std::vector<int>>& neighbors,
+                                   unsigned int threads,
+                                   std::uint64_t* hash) {
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 2; // 保底機制
+
+    auto serial = [&]() {
+        return neighbors.empty() ? twoOptBlocked(path, distMatrix, n, hash)
+                                 : twoOptNeighborList(path, distMatrix, n, neighbors, hash);
+    };
+    // 區段太短時，區段內可行的移動太少，直接序列處理
+    const int minSegment = 64;
+    int segments = static_cast<int>(std::min<unsigned int>(threads, static_cast<unsigned int>(n / minSegment)));
+    if (segments < 2) return serial();
+
+    const double eps = 1e-10;
+    const double* dist = distMatrix.data();
+    int segLen = (n + segments - 1) / segments;
+
+    std::vector<int> pos(n), owner(n);
+    std::vector<char> queued(n);
+    std::vector<std::uint64_t> deltas(segments); // 各區段的雜湊增量 (各自寫入，回合結束時合併)
+    double totalGain = 0.0;
+    int idleRounds = 0;
+
+    for (int round = 0; idleRounds < 2; ++round) {
+        // 交替以 0 與半個區段長度作為切點偏移；旋轉陣列不改變封閉迴路
+        if (round > 0) std::rotate(path.begin(), path.begin() + segLen / 2, path.end());
+        int* p = path.data();
+        for (int k = 0; k < n; ++k) {
+            pos[p[k]] = k;
+            owner[p[k]] = k / segLen;
+        }
+
+        std::vector<std::future<double>> futures;
+        for (int seg = 0; seg < segments; ++seg) {
+            int lo = seg * segLen;
+            int hi = std::min(n, lo + segLen);
+            if (hi - lo < 4) continue;
+            std::uint64_t* delta = hash ? &deltas[seg] : nullptr;
+            futures.push_back(std::async(std::launch::async, [&, seg, lo, hi, delta]() {
+                if (neighbors.empty()) return twoOptBlockedRange(p + lo, hi - lo, dist, n, delta);
+                return segmentNeighborTwoOpt(p, lo, hi, dist, n, neighbors, pos, owner, queued, seg, delta);
+            }));
+        }
+        double roundGain = 0.0;
+        for (auto& f : futures) {
+            roundGain += f.get();
+        }
+        if (hash) {
+            for (std::uint64_t& delta : deltas) {
+                *hash ^= delta;
+                delta = 0;
+            }
+        }
+
+        totalGain += roundGain;
+        idleRounds = (roundGain > eps) ? 0 : idleRounds + 1;
+    }
+
+    // 收尾：補上兩端落在不同區段的長距離移動 (此時路徑已接近局部最優，序列掃描很快結束)
+    return totalGain + serial();
+}
+
+double LocalSearch::segmentNeighborTwoOpt(int* p, int lo, int hi, const double* dist, int n,
+                                          const std::vector<std::vector<int>>& neighbors,
+                                          std::vector<int>& pos, const std::vector<int>& owner,
+                                          std::vector<char>& queued, int segment, std::uint64_t* hash) {
+    auto d = [dist, n](int a, int b) { return dist[static_cast<std::size_t>(a) * n + b]; };
+    const double eps = 1e-10;
+    double totalGain = 0.0;
+
+    std::deque<int> queue(p + lo, p + hi);
+    for (int k = lo; k < hi; ++k) queued[p[k]] = 1;
+    auto push = [&queue, &queued](int c) {
+        if (!queued[c]) {
+            queued[c] = 1;
+            queue.push_back(c);
+        }
+    };
+    auto reverse = [p, &pos](int l, int r) {
+        std::reverse(p + l, p + r + 1);
+        for (int k = l; k <= r; ++k) pos[p[k]] = k;
+    };
+
+    while (!queue.empty()) {
+        int a = queue.front();
+        queue.pop_front();
+        queued[a] = 0;
+
+        bool improved = false;
+        // dir = 0 以 a 的後繼、dir = 1 以 a 的前驅作為被移除的邊；兩條邊都必須在區段內部
+        for (int dir = 0; dir < 2 && !improved; ++dir) {
+            int step = (dir == 0) ? 1 : -1;
+            int pa = pos[a];
+            if (pa + step < lo || pa + step >= hi) continue;
+            int b = p[pa + step];
+            double dab = d(a, b);
+
+            for (int c : neighbors[a]) {
+                double dac = d(a, c);
+                if (dac >= dab) break; // 近鄰清單遞增：後續候選不可能再有正增益
+                if (owner[c] != segment || c == b) continue;
+                int pc = pos[c];
+                if (pc + step < lo || pc + step >= hi) continue;
+                int dd = p[pc + step];
+                if (dd == a) continue;
+
+                double gain = dab + d(c, dd) - dac - d(b, dd);
+                if (gain > eps) {
+                    // 移除 (a,b)、(c,dd)，加入 (a,c)、(b,dd)：翻轉兩條邊之間的子序列
+                    if (dir == 0) {
+                        if (pa < pc) reverse(pa + 1, pc); else reverse(pc + 1, pa);
+                    } else {
+                        if (pa < pc) reverse(pa, pc - 1); else reverse(pc, pa - 1);
+                    }
+                    if (hash) *hash ^= TourHash::twoOptDelta(a, b, c, dd);
+                    totalGain += gain;
+                    push(a); push(b); push(c); push(dd);
+                    improved = true;
+                    break;
+                }
+            }
+        }
+    }
+    return totalGain;
+}
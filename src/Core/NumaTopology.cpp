@@ -0,0 +1,126 @@
+#include "Core/NumaTopology.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+// 解析 Linux cpulist 格式，例如 "0-3,8-11"
+std::vector<int> parseCpuList(const std::string& text) {
+    std::vector<int> cpus;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) continue;
+        auto dash = item.find('-');
+        try {
+            if (dash == std::string::npos) {
+                cpus.push_back(std::stoi(item));
+            } else {
+                int lo = std::stoi(item.substr(0, dash));
+                int hi = std::stoi(item.substr(dash + 1));
+                for (int c = lo; c <= hi; ++c) cpus.push_back(c);
+            }
+        } catch (const std::exception&) {
+            // 格式不符的片段直接略過
+        }
+    }
+    return cpus;
+}
+}
+
+NumaTopology NumaTopology::detect() {
+    NumaTopology topo;
+
+#ifdef __linux__
+    // 節點編號可能不連續 (例如記憶體熱插拔後)，逐一嘗試直到連續多個不存在為止
+    for (int node = 0, misses = 0; misses < 8; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file.is_open()) {
+            ++misses;
+            continue;
+        }
+        misses = 0;
+        std::string line;
+        std::getline(file, line);
+        std::vector<int> cpus = parseCpuList(line);
+        if (!cpus.empty()) topo.m_nodeCpus.push_back(std::move(cpus)); // 純記憶體節點不列入
+    }
+#endif
+
+    if (topo.m_nodeCpus.empty()) {
+        unsigned int hw = std::thread::hardware_concurrency();
+        if (hw == 0) hw = 2; // 保底機制
+        std::vector<int> all(hw);
+        for (unsigned int c = 0; c < hw; ++c) all[c] = static_cast<int>(c);
+        topo.m_nodeCpus.push_back(std::move(all));
+    }
+    return topo;
+}
+
+int NumaTopology::cpuForWorker(int worker) const {
+    const std::vector<int>& cpus = m_nodeCpus[nodeForWorker(worker)];
+    return cpus[(worker / nodeCount()) % cpus.size()];
+}
+
+bool NumaTopology::pinCurrentThread(int cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+std::string NumaTopology::describePlacement(const std::string& label, const void* addr, std::size_t bytes) {
+    std::ostringstream out;
+    out << label << " (" << std::fixed << std::setprecision(1) << bytes / (1024.0 * 1024.0) << " MB): ";
+
+#if defined(__linux__) && defined(SYS_move_pages)
+    const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    auto begin = reinterpret_cast<std::uintptr_t>(addr) & ~(pageSize - 1);
+    auto end = reinterpret_cast<std::uintptr_t>(addr) + bytes;
+    std::size_t pageCount = (end - begin + pageSize - 1) / pageSize;
+
+    // 最多抽樣 4096 頁，避免大矩陣的查詢本身成為負擔
+    std::size_t stride = std::max<std::size_t>(1, pageCount / 4096);
+    std::vector<void*> pages;
+    for (std::size_t p = 0; p < pageCount; p += stride) {
+        pages.push_back(reinterpret_cast<void*>(begin + p * pageSize));
+    }
+    std::vector<int> status(pages.size(), -1);
+
+    // nodes 傳入 nullptr 時 move_pages 僅查詢，不搬移頁面
+    long rc = syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0);
+    if (rc == 0 && !pages.empty()) {
+        std::map<int, std::size_t> histogram;
+        for (int s : status) histogram[s]++;
+        bool first = true;
+        for (const auto& [node, count] : histogram) {
+            out << (first ? "" : ", ");
+            if (node >= 0) out << "node" << node;
+            else out << "unmapped";
+            out << " " << std::setprecision(1) << 100.0 * count / pages.size() << "%";
+            first = false;
+        }
+        return out.str();
+    }
+#else
+    (void)addr;
+#endif
+    out << "unknown";
+    return out.str();
+}
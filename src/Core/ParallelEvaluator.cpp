@@ -1,4 +1,6 @@
 #include "Core/ParallelEvaluator.h"
+#include "Core/TourHash.h"
+#include "Core/FixedKernels.h"
 #include <future>
 #include <thread>
 #include <algorithm>
@@ -7,35 +9,44 @@
 void ParallelEvaluator::evaluate(std::vector<Individual>& population, 
                                  const std::vector<double>& distMatrix, 
                                  int cityCount,
-                                 bool useParallel) {
-    if (useParallel && population.size() > 64) {
+                                 bool useParallel,
+                                 FitnessCache* cache) {
+    if (useParallel && static_cast<int>(population.size()) > m_parallelThreshold) {
         // --- [模式 A] 批次並行處理 (Batched std::async) ---
         
-        // 1. 獲取硬體支援的執行緒數量 (標準 C++11)
-        unsigned int numThreads = std::thread::hardware_concurrency();
-        if (numThreads == 0) numThreads = 2; // 保底機制
-
+        // 1. 批次數量與切分 (與 GASolver 的初始化、繁衍共用，同一區間固定由同一個 worker 處理)
+        unsigned int numThreads = workerCount();
         int totalSize = population.size();
-        int batchSize = totalSize / numThreads;
         std::vector<std::future<void>> futures;
 
         for (unsigned int i = 0; i < numThreads; ++i) {
-            int startIdx = i * batchSize;
-            int endIdx = (i == numThreads - 1) ? totalSize : (i + 1) * batchSize;
+            std::pair<int, int> range = batchRange(totalSize, numThreads, i);
+            int startIdx = range.first;
+            int endIdx = range.second;
 
             // 確保該區段有效
-            if (startIdx >= endIdx) break;
+            if (startIdx >= endIdx) continue;
 
             // 使用 std::async 啟動批次任務
             // 這裡我們改用 Lambda 函式來包裝「一段路徑」的計算
             // 1. std::launch::async: 強制開啟新執行緒執行
             // 2. [this, &population, &distMatrix]: 捕獲列表，傳入 this 指標以呼叫成員函式
             // 3. 透過引用 (&) 傳遞大資料 (population, distMatrix)，效能等同 std::ref
-            futures.push_back(std::async(std::launch::async, [this, &population, &distMatrix, cityCount, startIdx, endIdx]() {
+            futures.push_back(std::async(std::launch::async, [this, &population, &distMatrix, cityCount, cache, startIdx, endIdx, i]() {
+                // 拓撲感知模式：先綁定 CPU，再使用所在節點的本地矩陣複本
+                const std::vector<double>* matrix = &distMatrix;
+                if (m_topology) {
+                    NumaTopology::pinCurrentThread(m_topology->cpuForWorker(i));
+                    int node = m_topology->nodeForWorker(i);
+                    if (node < static_cast<int>(m_replicas.size()) && m_replicas[node]) {
+                        matrix = m_replicas[node];
+                    }
+                }
+
                 for (int j = startIdx; j < endIdx; ++j) {
                     // 呼叫成員函式：這裡同樣需要 this 指標來執行 evaluateIndividual
                     // 並且操作的是 population[j] 的引用
-                    this->evaluateIndividual(population[j], distMatrix, cityCount);
+                    this->evaluateIndividual(population[j], *matrix, cityCount, cache);
                 }
             }));
         }
@@ -47,31 +58,60 @@ void ParallelEvaluator::evaluate(std::vector<Individual>& population,
     } else {
         // --- [模式 B] 序列處理 (Serial Evaluation) ---
         for (auto& ind : population) {
-            evaluateIndividual(ind, distMatrix, cityCount);
+            evaluateIndividual(ind, distMatrix, cityCount, cache);
         }
     }
 }
 
+void ParallelEvaluator::setThreading(unsigned int threadCount, int parallelThreshold) {
+    m_threadCount = threadCount;
+    m_parallelThreshold = parallelThreshold;
+}
+
+unsigned int ParallelEvaluator::workerCount() const {
+    // 優先採用設定值，否則使用硬體支援數量 (標準 C++11)
+    unsigned int numThreads = m_threadCount ? m_threadCount : std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 2; // 保底機制
+    return numThreads;
+}
+
+std::pair<int, int> ParallelEvaluator::batchRange(int total, unsigned int batches, unsigned int batch) {
+    long long begin = static_cast<long long>(total) * batch / batches;
+    long long end = static_cast<long long>(total) * (batch + 1) / batches;
+    return {static_cast<int>(begin), static_cast<int>(end)};
+}
+
+void ParallelEvaluator::setPlacement(const NumaTopology* topology,
+                                     std::vector<const std::vector<double>*> replicas) {
+    m_topology = topology;
+    m_replicas = std::move(replicas);
+}
+
 void ParallelEvaluator::evaluateIndividual(Individual& ind, 
                                            const std::vector<double>& distMatrix, 
-                                           int cityCount) {
-    double totalDist = 0.0;
-    
-    // 計算路徑中相鄰城市的距離之和
-    for (int i = 0; i < cityCount - 1; ++i) {
-        int from = ind.path[i];
-        int to = ind.path[i + 1];
-        // 透過扁平化索引進行 O(1) 查表
-        totalDist += distMatrix[from * cityCount + to];
+                                           int cityCount,
+                                           FitnessCache* cache) {
+    // 快取路徑：雜湊為純算術運算 (無隨機記憶體存取)，命中時即可跳過距離查表
+    if (cache) {
+        if (ind.hash == 0) ind.hash = TourHash::compute(ind.path);
+        double cached;
+        if (cache->lookup(ind.hash, cached)) {
+            ind.distance = cached;
+            ind.fitness = 1.0 / (cached + 1.0);
+            return;
+        }
     }
 
-    // 最後要加上「回到起點」的距離，形成一個封閉迴圈
-    int last = ind.path[cityCount - 1];
-    int first = ind.path[0];
-    totalDist += distMatrix[last * cityCount + first];
+    // 計算路徑中相鄰城市的距離之和，並加上「回到起點」的距離形成封閉迴圈
+    // 依 n 分派至固定大小核心，透過扁平化索引進行 O(1) 查表
+    double totalDist = FixedKernels::tourLength(ind.path, distMatrix, cityCount);
 
     // 更新個體屬性
     ind.distance = totalDist;
     // 適應度通常與距離成反比，這裡加上 1.0 是為了防止除以零的極端情況
     ind.fitness = 1.0 / (totalDist + 1.0);
+
+    if (cache) {
+        cache->insert(ind.hash, totalDist);
+    }
 }
\ No newline at end of file
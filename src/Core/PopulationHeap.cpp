@@ -0,0 +1,114 @@
+#include "Core/PopulationHeap.h"
+#include <utility>
+
+void PopulationHeap::build(const std::vector<Individual>& population) {
+    int n = static_cast<int>(population.size());
+    m_heap.resize(n);
+    m_pos.resize(n);
+    m_keys.resize(n);
+
+    for (int i = 0; i < n; ++i) {
+        m_heap[i] = i;
+        m_pos[i] = i;
+        m_keys[i] = population[i].distance;
+    }
+
+    // 自底向上 heapify：從最後一個內部節點開始往下調整
+    for (int pos = n / 2 - 1; pos >= 0; --pos) {
+        pushDown(pos);
+    }
+}
+
+int PopulationHeap::maxIndex() const {
+    int n = size();
+    if (n == 1) return m_heap[0];
+    if (n == 2) return m_heap[1];
+    return (m_keys[m_heap[1]] >= m_keys[m_heap[2]]) ? m_heap[1] : m_heap[2];
+}
+
+void PopulationHeap::update(int index, double key) {
+    m_keys[index] = key;
+    int pos = m_pos[index];
+    bool minLevel = isMinLevel(pos);
+
+    if (pos > 0) {
+        int parent = (pos - 1) / 2;
+        // 與父節點 (相反層別) 衝突：交換後沿著父節點的層別往上，
+        // 換下來的舊父節點值則需在子樹中往下歸位
+        if (better(parent, pos, minLevel)) {
+            swapPos(pos, parent);
+            pushUpGrand(parent, !minLevel);
+            pushDown(pos);
+            return;
+        }
+    }
+
+    // 與祖先無衝突時，只需往上 (同層別祖父) 或往下其中一個方向調整
+    if (!pushUpGrand(pos, minLevel)) {
+        pushDown(pos);
+    }
+}
+
+bool PopulationHeap::isMinLevel(int pos) {
+    // 層數 = floor(log2(pos + 1))，偶數層為最小層
+    int level = 0;
+    for (unsigned int v = static_cast<unsigned int>(pos) + 1; v > 1; v >>= 1) {
+        ++level;
+    }
+    return (level % 2) == 0;
+}
+
+bool PopulationHeap::better(int posA, int posB, bool minLevel) const {
+    double a = m_keys[m_heap[posA]];
+    double b = m_keys[m_heap[posB]];
+    return minLevel ? (a < b) : (a > b);
+}
+
+void PopulationHeap::swapPos(int a, int b) {
+    std::swap(m_heap[a], m_heap[b]);
+    m_pos[m_heap[a]] = a;
+    m_pos[m_heap[b]] = b;
+}
+
+bool PopulationHeap::pushUpGrand(int pos, bool minLevel) {
+    bool moved = false;
+    // pos > 2 代表存在祖父節點
+    while (pos > 2) {
+        int grand = ((pos - 1) / 2 - 1) / 2;
+        if (!better(pos, grand, minLevel)) break;
+        swapPos(pos, grand);
+        pos = grand;
+        moved = true;
+    }
+    return moved;
+}
+
+void PopulationHeap::pushDown(int pos) {
+    int n = size();
+    bool minLevel = isMinLevel(pos);
+
+    while (true) {
+        int firstChild = 2 * pos + 1;
+        if (firstChild >= n) break;
+
+        // 在子節點與孫節點 (最多 2 + 4 個) 中找出最極端者
+        int m = firstChild;
+        if (firstChild + 1 < n && better(firstChild + 1, m, minLevel)) m = firstChild + 1;
+        int firstGrand = 4 * pos + 3;
+        for (int g = firstGrand; g < firstGrand + 4 && g < n; ++g) {
+            if (better(g, m, minLevel)) m = g;
+        }
+
+        if (!better(m, pos, minLevel)) break;
+        swapPos(m, pos);
+
+        if (m < firstGrand) break; // 與子節點交換後即到達正確位置
+
+        // 與孫節點交換：換下來的值可能與其父節點 (相反層別) 衝突
+        int parent = (m - 1) / 2;
+        if (better(parent, m, minLevel)) {
+            swapPos(m, parent);
+        }
+        pos = m;
+    }
+}
@@ -0,0 +1,84 @@
+#include "Core/ProblemInstance.h"
+#include "Core/TourConstructor.h"
+#include "Core/Utils.h"
+#include <stdexcept>
+#include <utility>
+
+ProblemInstance::ProblemInstance(std::vector<City> cities, std::vector<int> cityOrder, std::vector<double> distances,
+                                 std::vector<std::vector<int>> neighbors, bool hugePages)
+    : m_cities(std::move(cities)), m_cityOrder(std::move(cityOrder)), m_distances(std::move(distances)),
+      m_neighbors(std::move(neighbors)) {
+    if (hugePages) {
+        // 對已提示的範圍重複提示沒有副作用，只用來取得實際結果；若矩陣已寫入，則由 khugepaged 於背景合併
+        m_distanceBacking = HugePageArena::advise(m_distances.data(), m_distances.size() * sizeof(double));
+    }
+    if (!m_neighbors.empty()) {
+        // 已提供的清單視為建立完成，之後不再呼叫建構流程
+        std::call_once(m_neighborsOnce, []() {});
+        m_neighborsReady.store(true, std::memory_order_release);
+    }
+}
+
+std::shared_ptr<const ProblemInstance> ProblemInstance::create(const std::vector<City>& cities, bool renumber,
+                                                               unsigned int threads, bool hugePages) {
+    std::vector<City> ordered = cities;
+    std::vector<int> order;
+
+    // 選用：依 Hilbert 曲線順序重新編號，使地理上相鄰的城市在矩陣中也相鄰
+    if (renumber) {
+        order = Utils::hilbertOrder(cities);
+        for (int k = 0; k < static_cast<int>(order.size()); ++k) {
+            ordered[k] = cities[order[k]];
+            ordered[k].id = k;
+        }
+    }
+
+    std::vector<double> distances = Utils::precomputeDistanceMatrix(ordered, threads, hugePages);
+    return adopt(std::move(ordered), std::move(order), std::move(distances), {}, hugePages);
+}
+
+std::shared_ptr<const ProblemInstance> ProblemInstance::adopt(std::vector<City> cities, std::vector<int> cityOrder,
+                                                              std::vector<double> distances,
+                                                              std::vector<std::vector<int>> neighbors,
+                                                              bool hugePages) {
+    std::size_t n = cities.size();
+    if (distances.size() != n * n) {
+        throw std::runtime_error("ProblemInstance: distance matrix does not match the city count.");
+    }
+    if (!cityOrder.empty() && cityOrder.size() != n) {
+        throw std::runtime_error("ProblemInstance: city order does not match the city count.");
+    }
+    if (!neighbors.empty() && neighbors.size() != n) {
+        throw std::runtime_error("ProblemInstance: neighbor lists do not match the city count.");
+    }
+    // 建構子為私有，無法使用 std::make_shared
+    return std::shared_ptr<const ProblemInstance>(
+        new ProblemInstance(std::move(cities), std::move(cityOrder), std::move(distances), std::move(neighbors),
+                            hugePages));
+}
+
+std::vector<double> ProblemInstance::takeDistances(const std::shared_ptr<const ProblemInstance>& instance) {
+    // 實例一律以 new 建立 (見 adopt)，本身並非 const 物件；沒有其他持有者時可安全地搬移其成員
+    if (instance.use_count() == 1) {
+        return std::move(const_cast<ProblemInstance&>(*instance).m_distances);
+    }
+    return instance->m_distances;
+}
+
+const std::vector<std::vector<int>>& ProblemInstance::neighbors() const {
+    std::call_once(m_neighborsOnce, [this]() {
+        m_neighbors = TourConstructor::buildCandidateLists(m_distances, cityCount(), kNeighborCount);
+        m_neighborsReady.store(true, std::memory_order_release);
+    });
+    return m_neighbors;
+}
+
+std::vector<City> ProblemInstance::originalCities() const {
+    if (m_cityOrder.empty()) return m_cities;
+    std::vector<City> cities(m_cities.size());
+    for (std::size_t i = 0; i < m_cities.size(); ++i) {
+        cities[m_cityOrder[i]] = m_cities[i];
+        cities[m_cityOrder[i]].id = m_cityOrder[i];
+    }
+    return cities;
+}
@@ -0,0 +1,60 @@
+#include "Core/RandomStream.h"
+
+namespace {
+// SplitMix64：將單一種子擴展為互不相關的狀態字組 (xoshiro 作者建議的播種方式)
+std::uint64_t splitMix64(std::uint64_t& x) {
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+inline std::uint64_t rotl(std::uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+}
+
+RandomStream::RandomStream(std::uint64_t seed) {
+    this->seed(seed);
+}
+
+void RandomStream::seed(std::uint64_t seed) {
+    std::uint64_t x = seed;
+    for (int lane = 0; lane < kLanes; ++lane) {
+        for (int k = 0; k < 4; ++k) m_state[k][lane] = splitMix64(x);
+    }
+    m_position = kBufferSize;
+}
+
+void RandomStream::refill() {
+    // 狀態複製到區域陣列，讓編譯器確認與緩衝區沒有別名，內層 lane 迴圈即可向量化
+    std::uint64_t s0[kLanes], s1[kLanes], s2[kLanes], s3[kLanes];
+    for (int lane = 0; lane < kLanes; ++lane) {
+        s0[lane] = m_state[0][lane];
+        s1[lane] = m_state[1][lane];
+        s2[lane] = m_state[2][lane];
+        s3[lane] = m_state[3][lane];
+    }
+
+    for (int i = 0; i < kBufferSize; i += kLanes) {
+        for (int lane = 0; lane < kLanes; ++lane) {
+            // xoshiro256**：輸出 rotl(s1 * 5, 7) * 9
+            m_buffer[i + lane] = rotl(s1[lane] * 5, 7) * 9;
+            std::uint64_t t = s1[lane] << 17;
+            s2[lane] ^= s0[lane];
+            s3[lane] ^= s1[lane];
+            s1[lane] ^= s2[lane];
+            s0[lane] ^= s3[lane];
+            s2[lane] ^= t;
+            s3[lane] = rotl(s3[lane], 45);
+        }
+    }
+
+    for (int lane = 0; lane < kLanes; ++lane) {
+        m_state[0][lane] = s0[lane];
+        m_state[1][lane] = s1[lane];
+        m_state[2][lane] = s2[lane];
+        m_state[3][lane] = s3[lane];
+    }
+    m_position = 0;
+}
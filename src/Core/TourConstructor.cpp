@@ -0,0 +1,215 @@
+#include "Core/TourConstructor.h"
+#include "Core/Utils.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+std::vector<int> TourConstructor::nearestNeighbor(const std::vector<double>& distMatrix, int n,
+                                                  double randomness) {
+    std::vector<int> path;
+    path.reserve(n);
+    std::vector<bool> visited(n, false);
+
+    int current = Utils::getRandomInt(0, n - 1);
+    path.push_back(current);
+    visited[current] = true;
+
+    for (int step = 1; step < n; ++step) {
+        // 同時追蹤最近與次近的未拜訪城市
+        int best = -1, second = -1;
+        double bestDist = std::numeric_limits<double>::max();
+        double secondDist = std::numeric_limits<double>::max();
+        const double* row = &distMatrix[static_cast<size_t>(current) * n];
+
+        for (int c = 0; c < n; ++c) {
+            if (visited[c]) continue;
+            if (row[c] < bestDist) {
+                second = best; secondDist = bestDist;
+                best = c; bestDist = row[c];
+            } else if (row[c] < secondDist) {
+                second = c; secondDist = row[c];
+            }
+        }
+
+        int next = (second >= 0 && Utils::getRandomDouble() < randomness) ? second : best;
+        path.push_back(next);
+        visited[next] = true;
+        current = next;
+    }
+    return path;
+}
+
+std::vector<int> TourConstructor::nearestNeighbor(const std::vector<double>& distMatrix, int n,
+                                                  const std::vector<std::vector<int>>& candidates,
+                                                  double randomness) {
+    std::vector<int> path;
+    path.reserve(n);
+    std::vector<bool> visited(n, false);
+
+    int current = Utils::getRandomInt(0, n - 1);
+    path.push_back(current);
+    visited[current] = true;
+
+    for (int step = 1; step < n; ++step) {
+        // 近鄰清單已依距離排序：前兩個未拜訪者即為最近與次近
+        int best = -1, second = -1;
+        for (int c : candidates[current]) {
+            if (visited[c]) continue;
+            if (best < 0) {
+                best = c;
+            } else {
+                second = c;
+                break;
+            }
+        }
+
+        if (best < 0) {
+            // 近鄰全數已拜訪：退回整列掃描
+            double bestDist = std::numeric_limits<double>::max();
+            const double* row = &distMatrix[static_cast<size_t>(current) * n];
+            for (int c = 0; c < n; ++c) {
+                if (!visited[c] && row[c] < bestDist) {
+                    best = c;
+                    bestDist = row[c];
+                }
+            }
+        }
+
+        int next = (second >= 0 && Utils::getRandomDouble() < randomness) ? second : best;
+        path.push_back(next);
+        visited[next] = true;
+        current = next;
+    }
+    return path;
+}
+
+std::vector<int> TourConstructor::greedyEdge(const std::vector<double>& distMatrix, int n,
+                                             const std::vector<std::vector<int>>& candidates,
+                                             double noise) {
+    if (n < 3) {
+        std::vector<int> path(n);
+        std::iota(path.begin(), path.end(), 0);
+        return path;
+    }
+
+    // 1. 收集候選邊 (i < j 去重) 並加上隨機擾動後排序
+    struct Edge { double weight; int a; int b; };
+    std::vector<Edge> edges;
+    edges.reserve(static_cast<size_t>(n) * (candidates.empty() ? 0 : candidates[0].size()));
+    for (int i = 0; i < n; ++i) {
+        for (int j : candidates[i]) {
+            if (i < j) {
+                double w = distMatrix[static_cast<size_t>(i) * n + j];
+                edges.push_back({w * (1.0 + Utils::getRandomDouble(-noise, noise)), i, j});
+            }
+        }
+    }
+    std::sort(edges.begin(), edges.end(), [](const Edge& x, const Edge& y) { return x.weight < y.weight; });
+
+    // 2. 以並查集 (Union-Find) 防止子迴路，度數上限為 2
+    std::vector<int> parent(n);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]]; // 路徑減半
+            x = parent[x];
+        }
+        return x;
+    };
+
+    std::vector<int> adj(2 * static_cast<size_t>(n), -1); // 每個城市最多兩個鄰居
+    std::vector<int> degree(n, 0);
+    int added = 0;
+    for (const auto& e : edges) {
+        if (added == n - 1) break;
+        if (degree[e.a] >= 2 || degree[e.b] >= 2) continue;
+        int ra = find(e.a), rb = find(e.b);
+        if (ra == rb) continue;
+        parent[ra] = rb;
+        adj[2 * e.a + degree[e.a]++] = e.b;
+        adj[2 * e.b + degree[e.b]++] = e.a;
+        ++added;
+    }
+
+    // 3. 走訪片段並以最近端點串接 (片段端點 = 度數小於 2 的城市)
+    std::vector<bool> visited(n, false);
+    std::vector<int> endpoints;
+    for (int i = 0; i < n; ++i) {
+        if (degree[i] < 2) endpoints.push_back(i);
+    }
+
+    std::vector<int> path;
+    path.reserve(n);
+    int start = endpoints[Utils::getRandomInt(0, static_cast<int>(endpoints.size()) - 1)];
+
+    while (true) {
+        // 沿著片段走到另一端
+        int prev = -1, cur = start;
+        while (cur != -1) {
+            path.push_back(cur);
+            visited[cur] = true;
+            int next = -1;
+            for (int k = 0; k < degree[cur]; ++k) {
+                int nb = adj[2 * cur + k];
+                if (nb != prev && !visited[nb]) next = nb;
+            }
+            prev = cur;
+            cur = next;
+        }
+        if (static_cast<int>(path.size()) == n) break;
+
+        // 從片段尾端出發，尋找最近的未拜訪端點
+        int tail = path.back();
+        int bestEnd = -1;
+        double bestDist = std::numeric_limits<double>::max();
+        size_t keep = 0;
+        for (size_t k = 0; k < endpoints.size(); ++k) {
+            int e = endpoints[k];
+            if (visited[e]) continue;
+            endpoints[keep++] = e; // 順便壓縮已拜訪的端點
+            double d = distMatrix[static_cast<size_t>(tail) * n + e];
+            if (d < bestDist) {
+                bestDist = d;
+                bestEnd = e;
+            }
+        }
+        endpoints.resize(keep);
+        start = bestEnd;
+    }
+    return path;
+}
+
+std::vector<int> TourConstructor::spaceFillingCurve(const std::vector<City>& cities) {
+    // 隨機旋轉座標，讓 Hilbert 曲線以不同方向掃過平面
+    const double pi = std::acos(-1.0);
+    double angle = Utils::getRandomDouble(0.0, 2.0 * pi);
+    double cosA = std::cos(angle), sinA = std::sin(angle);
+
+    std::vector<City> rotated(cities.size());
+    for (size_t i = 0; i < cities.size(); ++i) {
+        rotated[i] = {cities[i].id,
+                      cities[i].x * cosA - cities[i].y * sinA,
+                      cities[i].x * sinA + cities[i].y * cosA};
+    }
+    return Utils::hilbertOrder(rotated);
+}
+
+std::vector<std::vector<int>> TourConstructor::buildCandidateLists(const std::vector<double>& distMatrix,
+                                                                    int n, int k) {
+    k = std::min(k, n - 1);
+    std::vector<std::vector<int>> lists(n);
+    std::vector<int> others(n > 0 ? n - 1 : 0);
+
+    for (int i = 0; i < n; ++i) {
+        const double* row = &distMatrix[static_cast<size_t>(i) * n];
+        int m = 0;
+        for (int j = 0; j < n; ++j) {
+            if (j != i) others[m++] = j;
+        }
+        auto byDist = [row](int a, int b) { return row[a] < row[b]; };
+        std::partial_sort(others.begin(), others.begin() + k, others.end(), byDist);
+        lists[i].assign(others.begin(), others.begin() + k);
+    }
+    return lists;
+}
@@ -0,0 +1,54 @@
+#include "Core/TourHash.h"
+#include <algorithm>
+
+namespace {
+// splitmix64 混合函式：將結構化的輸入打散成近似均勻分佈的 64-bit 值
+inline std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+}
+
+std::uint64_t TourHash::edgeKey(int a, int b) {
+    // 以 (min, max) 排序端點，確保 (a, b) 與 (b, a) 得到相同金鑰
+    std::uint64_t lo = static_cast<std::uint32_t>(std::min(a, b));
+    std::uint64_t hi = static_cast<std::uint32_t>(std::max(a, b));
+    return splitmix64((hi << 32) | lo);
+}
+
+std::uint64_t TourHash::compute(const std::vector<int>& path) {
+    std::uint64_t hash = 0;
+    int n = static_cast<int>(path.size());
+    for (int i = 0; i < n; ++i) {
+        hash ^= edgeKey(path[i], path[(i + 1) % n]);
+    }
+    // 0 保留為「未計算」標記
+    return hash == 0 ? 1 : hash;
+}
+
+void TourHash::swapCities(std::vector<int>& path, int i, int j, std::uint64_t& hash) {
+    int n = static_cast<int>(path.size());
+    if (i == j || n < 2) return;
+
+    if (hash == 0) {
+        std::swap(path[i], path[j]);
+        return;
+    }
+
+    // 受影響的邊以「起點位置」表示：邊 k 連接 path[k] 與 path[(k + 1) % n]
+    int edges[4] = {(i - 1 + n) % n, i, (j - 1 + n) % n, j};
+    std::sort(edges, edges + 4);
+    int count = static_cast<int>(std::unique(edges, edges + 4) - edges);
+
+    for (int e = 0; e < count; ++e) {
+        hash ^= edgeKey(path[edges[e]], path[(edges[e] + 1) % n]);
+    }
+    std::swap(path[i], path[j]);
+    for (int e = 0; e < count; ++e) {
+        hash ^= edgeKey(path[edges[e]], path[(edges[e] + 1) % n]);
+    }
+
+    if (hash == 0) hash = TourHash::compute(path);
+}
@@ -0,0 +1,171 @@
+#include "Core/TwoLevelList.h"
+#include <algorithm>
+#include <cmath>
+
+TwoLevelList::TwoLevelList(const std::vector<int>& path)
+    : m_n(static_cast<int>(path.size())) {
+    m_targetSize = std::max(8, static_cast<int>(std::sqrt(static_cast<double>(m_n))));
+    m_segOf.resize(m_n);
+    m_offset.resize(m_n);
+    rebuild(path);
+}
+
+void TwoLevelList::rebuild(const std::vector<int>& path) {
+    m_segments.clear();
+    m_order.clear();
+
+    for (int from = 0; from < m_n; from += m_targetSize) {
+        int to = std::min(m_n, from + m_targetSize);
+        int id = static_cast<int>(m_segments.size());
+        Segment seg;
+        seg.cities.assign(path.begin() + from, path.begin() + to);
+        for (int k = 0; k < to - from; ++k) {
+            m_segOf[seg.cities[k]] = id;
+            m_offset[seg.cities[k]] = k;
+        }
+        m_segments.push_back(std::move(seg));
+        m_order.push_back(id);
+    }
+
+    m_rank.assign(m_segments.size(), 0);
+    m_start.assign(m_order.size(), 0);
+    refreshRanks(0, static_cast<int>(m_order.size()) - 1);
+}
+
+int TwoLevelList::firstOf(int seg) const {
+    const Segment& s = m_segments[seg];
+    return s.reversed ? s.cities.back() : s.cities.front();
+}
+
+int TwoLevelList::lastOf(int seg) const {
+    const Segment& s = m_segments[seg];
+    return s.reversed ? s.cities.front() : s.cities.back();
+}
+
+int TwoLevelList::next(int c) const {
+    int seg = m_segOf[c];
+    const Segment& s = m_segments[seg];
+    int k = m_offset[c] + (s.reversed ? -1 : 1);
+    if (k >= 0 && k < static_cast<int>(s.cities.size())) return s.cities[k];
+
+    int r = (m_rank[seg] + 1) % static_cast<int>(m_order.size());
+    return firstOf(m_order[r]);
+}
+
+int TwoLevelList::prev(int c) const {
+    int seg = m_segOf[c];
+    const Segment& s = m_segments[seg];
+    int k = m_offset[c] + (s.reversed ? 1 : -1);
+    if (k >= 0 && k < static_cast<int>(s.cities.size())) return s.cities[k];
+
+    int count = static_cast<int>(m_order.size());
+    int r = (m_rank[seg] - 1 + count) % count;
+    return lastOf(m_order[r]);
+}
+
+int TwoLevelList::sequence(int c) const {
+    int seg = m_segOf[c];
+    const Segment& s = m_segments[seg];
+    int k = s.reversed ? static_cast<int>(s.cities.size()) - 1 - m_offset[c] : m_offset[c];
+    return m_start[m_rank[seg]] + k;
+}
+
+bool TwoLevelList::between(int a, int b, int c) const {
+    int pa = sequence(a), pb = sequence(b), pc = sequence(c);
+    int db = (pb - pa + m_n) % m_n;
+    int dc = (pc - pa + m_n) % m_n;
+    return db <= dc;
+}
+
+void TwoLevelList::reverse(int a, int b) {
+    int i = sequence(a), j = sequence(b);
+    if (i <= j) {
+        reverseRange(i, j);
+    } else if (j + 1 <= i - 1) {
+        // 繞過尾端：翻轉補集 [j+1, i-1]，得到相同的封閉迴路
+        reverseRange(j + 1, i - 1);
+    }
+}
+
+std::vector<int> TwoLevelList::toPath() const {
+    std::vector<int> path;
+    path.reserve(m_n);
+    for (int seg : m_order) {
+        const Segment& s = m_segments[seg];
+        if (s.reversed) {
+            path.insert(path.end(), s.cities.rbegin(), s.cities.rend());
+        } else {
+            path.insert(path.end(), s.cities.begin(), s.cities.end());
+        }
+    }
+    return path;
+}
+
+int TwoLevelList::rankAt(int pos) const {
+    // m_start 遞增：找最後一個 start <= pos 的區段
+    auto it = std::upper_bound(m_start.begin(), m_start.end(), pos);
+    return static_cast<int>(it - m_start.begin()) - 1;
+}
+
+void TwoLevelList::refreshRanks(int from, int to) {
+    for (int r = from; r <= to; ++r) {
+        m_rank[m_order[r]] = r;
+        m_start[r] = (r == 0) ? 0 : m_start[r - 1] + static_cast<int>(m_segments[m_order[r - 1]].cities.size());
+    }
+}
+
+void TwoLevelList::splitAt(int pos) {
+    if (pos <= 0 || pos >= m_n) return;
+    int r = rankAt(pos);
+    int k = pos - m_start[r]; // 依走訪方向的切點
+    if (k == 0) return;
+
+    int id = m_order[r];
+    int newId = static_cast<int>(m_segments.size());
+    m_segments.emplace_back();
+    Segment& head = m_segments[id];
+    Segment& tail = m_segments[newId];
+    int size = static_cast<int>(head.cities.size());
+    tail.reversed = head.reversed;
+
+    // 走訪方向的後半段移入新區段；反轉區段的後半段位於原始陣列的前端
+    if (!head.reversed) {
+        tail.cities.assign(head.cities.begin() + k, head.cities.end());
+        head.cities.resize(k);
+    } else {
+        tail.cities.assign(head.cities.begin(), head.cities.begin() + (size - k));
+        head.cities.erase(head.cities.begin(), head.cities.begin() + (size - k));
+        for (int q = 0; q < k; ++q) m_offset[head.cities[q]] = q;
+    }
+    for (int q = 0; q < static_cast<int>(tail.cities.size()); ++q) {
+        m_segOf[tail.cities[q]] = newId;
+        m_offset[tail.cities[q]] = q;
+    }
+
+    m_order.insert(m_order.begin() + r + 1, newId);
+    m_rank.push_back(0);
+    m_start.push_back(0);
+    refreshRanks(r + 1, static_cast<int>(m_order.size()) - 1);
+}
+
+void TwoLevelList::reverseRange(int i, int j) {
+    if (i >= j) return;
+
+    // 1. 切開兩端，使 [i, j] 恰好由完整區段組成
+    splitAt(i);
+    splitAt(j + 1);
+    int r1 = rankAt(i);
+    int r2 = rankAt(j);
+
+    // 2. 倒置區段順序並切換反轉位元
+    std::reverse(m_order.begin() + r1, m_order.begin() + r2 + 1);
+    for (int r = r1; r <= r2; ++r) {
+        m_segments[m_order[r]].reversed = !m_segments[m_order[r]].reversed;
+    }
+    refreshRanks(r1, r2);
+
+    // 3. 區段過度碎片化時重建，維持 O(sqrt(n)) 的區段數量
+    if (static_cast<int>(m_order.size()) > 2 * (m_n / m_targetSize) + 4) {
+        rebuild(toPath());
+    }
+}
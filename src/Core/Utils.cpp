@@ -1,9 +1,47 @@
 #include "Core/Utils.h"
+#include "Core/HugePageArena.h"
 #include <cmath>
 #include <ctime>
+#include <thread>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include <condition_variable>
+#include <future>
+#include <mutex>
 
-// 初始化靜態引擎 (使用當前時間作為種子)
-std::mt19937 Utils::g_gen(static_cast<unsigned int>(std::time(nullptr)));
+namespace {
+// Hilbert 曲線索引：將 side x side 網格上的 (x, y) 映射為曲線上的距離 d
+std::uint64_t hilbertIndex(std::uint32_t side, std::uint32_t x, std::uint32_t y) {
+    std::uint64_t d = 0;
+    for (std::uint32_t s = side / 2; s > 0; s /= 2) {
+        std::uint32_t rx = (x & s) ? 1 : 0;
+        std::uint32_t ry = (y & s) ? 1 : 0;
+        d += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ ry);
+        // 旋轉象限，使子曲線方向一致
+        if (ry == 0) {
+            if (rx == 1) {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+// 為每個執行緒產生不同的種子：混合時間、硬體亂數與執行緒 ID，
+// 避免同一秒內啟動的多個工作執行緒得到完全相同的隨機序列
+unsigned int makeThreadSeed() {
+    std::random_device rd;
+    std::size_t tid = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return static_cast<unsigned int>(std::time(nullptr)) ^ rd() ^ static_cast<unsigned int>(tid);
+}
+}
+
+// 初始化執行緒區域引擎 (每個執行緒第一次使用時各自播種)
+thread_local std::mt19937 Utils::g_gen(makeThreadSeed());
+thread_local RandomStream Utils::g_stream(makeThreadSeed());
 
 std::vector<City> Utils::generateRandomCities(int n, double maxX, double maxY) {
     std::vector<City> cities;
@@ -17,37 +55,175 @@ std::vector<City> Utils::generateRandomCities(int n, double maxX, double maxY) {
     return cities;
 }
 
-std::vector<double> Utils::precomputeDistanceMatrix(const std::vector<City>& cities) {
-    int n = static_cast<int>(cities.size());
-    std::vector<double> matrix(n * n);
+std::vector<City> Utils::generateClusteredCities(int n, int clusters, double maxX, double maxY, double spread) {
+    clusters = std::max(1, clusters);
+    std::vector<City> centers = generateRandomCities(clusters, maxX, maxY);
+    std::normal_distribution<double> offset(0.0, spread * std::min(maxX, maxY));
+    std::uniform_int_distribution<int> pick(0, clusters - 1);
+
+    std::vector<City> cities;
+    cities.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        const City& c = centers[pick(g_gen)];
+        double x = std::clamp(c.x + offset(g_gen), 0.0, maxX);
+        double y = std::clamp(c.y + offset(g_gen), 0.0, maxY);
+        cities.push_back({i, x, y});
+    }
+    return cities;
+}
+
+std::vector<City> Utils::generateGridCities(int n, double maxX, double maxY, double jitter) {
+    std::vector<City> cities;
+    if (n <= 0) return cities;
+    cities.reserve(n);
+
+    int cols = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(n))));
+    int rows = (n + cols - 1) / cols;
+    double stepX = maxX / cols;
+    double stepY = maxY / rows;
+    std::uniform_real_distribution<double> noise(-jitter, jitter);
+
     for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < n; ++j) {
-            if (i == j) {
-                matrix[i * n + j] = 0.0; // 對角線為 0
+        double x = (i % cols + 0.5) * stepX;
+        double y = (i / cols + 0.5) * stepY;
+        if (jitter > 0.0) {
+            x += noise(g_gen) * stepX;
+            y += noise(g_gen) * stepY;
+        }
+        cities.push_back({i, x, y});
+    }
+    return cities;
+}
+
+std::vector<double> Utils::precomputeDistanceMatrix(const std::vector<City>& cities, unsigned int threads,
+                                                   bool hugePages) {
+    const int n = static_cast<int>(cities.size());
+    const std::size_t stride = static_cast<std::size_t>(n);
+    std::vector<double> matrix;
+    // 先保留 (大型配置由 mmap 取得、尚未寫入)，提示後再歸零，缺頁時核心即可直接配置大分頁
+    matrix.reserve(stride * stride);
+    if (hugePages) HugePageArena::advise(matrix.data(), stride * stride * sizeof(double));
+    matrix.resize(stride * stride);
+    if (n == 0) return matrix;
+
+    // SoA 座標：內層迴圈為連續讀取，sqrt 可向量化
+    std::vector<double> xs(n), ys(n);
+    for (int i = 0; i < n; ++i) {
+        xs[i] = cities[i].x;
+        ys[i] = cities[i].y;
+    }
+
+    // 兩階段，每一列只由所屬磚塊列寫入：
+    // 1. 上三角：計算磚塊列 ti 在對角線右側的磚塊 (含對角磚，於磚內鏡射)；
+    // 2. 下三角：自已完成的上三角轉置讀取，填入磚塊列 ti 在對角線左側的磚塊。
+    // (xi - xj)^2 與 (xj - xi)^2 相同，結果與逐項計算逐位元一致
+    const int tile = kDistanceTile;
+    const int tileCount = (n + tile - 1) / tile;
+    double* out = matrix.data();
+    auto upperTileRow = [&](int ti) {
+        int i0 = ti * tile;
+        int i1 = std::min(n, i0 + tile);
+        for (int tj = ti; tj < tileCount; ++tj) {
+            int j0 = tj * tile;
+            int j1 = std::min(n, j0 + tile);
+            for (int i = i0; i < i1; ++i) {
+                double xi = xs[i];
+                double yi = ys[i];
+                double* row = out + i * stride;
+                for (int j = std::max(j0, i); j < j1; ++j) {
+                    double dx = xi - xs[j];
+                    double dy = yi - ys[j];
+                    row[j] = std::sqrt(dx * dx + dy * dy);
+                }
+            }
+        }
+        for (int i = i0; i < i1; ++i) {
+            for (int j = i0; j < i; ++j) out[i * stride + j] = out[j * stride + i];
+        }
+    };
+    auto lowerTileRow = [&](int ti) {
+        int i0 = ti * tile;
+        int i1 = std::min(n, i0 + tile);
+        // 磚塊大小讓轉置讀取維持在快取內
+        for (int tj = 0; tj < ti; ++tj) {
+            int j0 = tj * tile;
+            int j1 = j0 + tile;
+            for (int i = i0; i < i1; ++i) {
+                double* row = out + i * stride;
+                for (int j = j0; j < j1; ++j) row[j] = out[j * stride + i];
+            }
+        }
+    };
+
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 2; // 保底機制
+    // 小矩陣的執行緒啟動成本高於計算本身
+    if (threads == 1 || n < 512) {
+        for (int ti = 0; ti < tileCount; ++ti) upperTileRow(ti);
+        for (int ti = 1; ti < tileCount; ++ti) lowerTileRow(ti);
+        return matrix;
+    }
+
+    // 每個執行緒負責連續的磚塊列並在兩階段中沿用同一批 (上三角工作量遞減、下三角遞增，合計每列相同)，
+    // 兩階段之間以計數器同步，確保轉置讀取時上三角已全部完成
+    threads = std::min<unsigned int>(threads, static_cast<unsigned int>(tileCount));
+    std::mutex phaseMutex;
+    std::condition_variable phaseDone;
+    unsigned int pending = threads;
+    auto worker = [&](unsigned int t) {
+        int first = static_cast<int>(static_cast<long long>(tileCount) * t / threads);
+        int last = static_cast<int>(static_cast<long long>(tileCount) * (t + 1) / threads);
+        for (int ti = first; ti < last; ++ti) upperTileRow(ti);
+        {
+            std::unique_lock<std::mutex> lock(phaseMutex);
+            if (--pending == 0) {
+                phaseDone.notify_all();
             } else {
-                double dx = cities[i].x - cities[j].x;
-                double dy = cities[i].y - cities[j].y;
-                matrix[i * n + j] = std::sqrt(dx * dx + dy * dy);
+                phaseDone.wait(lock, [&pending]() { return pending == 0; });
             }
         }
+        for (int ti = first; ti < last; ++ti) lowerTileRow(ti);
+    };
+    std::vector<std::future<void>> futures;
+    for (unsigned int t = 1; t < threads; ++t) {
+        futures.push_back(std::async(std::launch::async, worker, t));
+    }
+    worker(0);
+    for (auto& f : futures) {
+        f.get();
     }
     return matrix;
 }
 
+std::vector<int> Utils::hilbertOrder(const std::vector<City>& cities) {
+    int n = static_cast<int>(cities.size());
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    if (n == 0) return order;
+
+    // 以正方形包圍盒正規化座標，保持長寬比
+    double minX = cities[0].x, maxX = cities[0].x;
+    double minY = cities[0].y, maxY = cities[0].y;
+    for (const auto& c : cities) {
+        minX = std::min(minX, c.x); maxX = std::max(maxX, c.x);
+        minY = std::min(minY, c.y); maxY = std::max(maxY, c.y);
+    }
+    double span = std::max(maxX - minX, maxY - minY);
+    if (span <= 0.0) span = 1.0;
+
+    const std::uint32_t side = 1u << 16;
+    std::vector<std::uint64_t> keys(n);
+    for (int i = 0; i < n; ++i) {
+        auto gx = static_cast<std::uint32_t>((cities[i].x - minX) / span * (side - 1));
+        auto gy = static_cast<std::uint32_t>((cities[i].y - minY) / span * (side - 1));
+        keys[i] = hilbertIndex(side, gx, gy);
+    }
+
+    std::sort(order.begin(), order.end(), [&keys](int a, int b) { return keys[a] < keys[b]; });
+    return order;
+}
+
 double Utils::getDistance(int cityA, int cityB, const std::vector<double>& distMatrix, int n) {
     // 數學映射：(row, col) -> index
     return distMatrix[cityA * n + cityB];
 }
-
-int Utils::getRandomInt(int min, int max) {
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(g_gen);
-}
-
-double Utils::getRandomDouble(double min, double max) {
-    // 根據傳入的參數決定分佈區間
-    std::uniform_real_distribution<double> dist(min, max);
-    
-    // 使用你原本定義好的 g_gen (隨機數引擎)
-    return dist(getGenerator()); 
-}
\ No newline at end of file
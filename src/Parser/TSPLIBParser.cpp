@@ -5,17 +5,25 @@
 #include <algorithm>
 
 std::vector<City> TSPLIBParser::parse(const std::string& filePath) {
-    std::vector<City> cities;
     std::ifstream file(filePath);
 
     if (!file.is_open()) {
         throw std::runtime_error("TSPLIBParser: Cannot open file " + filePath);
     }
+    return parseStream(file, filePath);
+}
+
+std::vector<City> TSPLIBParser::parseString(const std::string& content) {
+    std::istringstream in(content);
+    return parseStream(in, "<string>");
+}
 
+std::vector<City> TSPLIBParser::parseStream(std::istream& in, const std::string& source) {
+    std::vector<City> cities;
     std::string line;
     bool isCoordSection = false;
 
-    while (std::getline(file, line)) {
+    while (std::getline(in, line)) {
         // 去除行首尾空格（簡單處理）
         line.erase(0, line.find_first_not_of(" \t\r\n"));
         if (line.empty()) continue;
@@ -44,7 +52,7 @@ std::vector<City> TSPLIBParser::parse(const std::string& filePath) {
     }
 
     if (cities.empty()) {
-        throw std::runtime_error("TSPLIBParser: No coordinates found in " + filePath);
+        throw std::runtime_error("TSPLIBParser: No coordinates found in " + source);
     }
 
     return cities;
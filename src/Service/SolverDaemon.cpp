@@ -0,0 +1,467 @@
+#include "Service/SolverDaemon.h"
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+#include "Parser/TSPLIBParser.h"
+#include "Service/TourPublisher.h"
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace {
+
+// 以 '\n' 切割的緩衝讀取器 (以位移記錄已消耗的位置，避免逐行搬移緩衝區)
+class LineReader {
+public:
+    explicit LineReader(int fd) : m_fd(fd) {}
+
+    bool next(std::string& line) {
+        while (true) {
+            std::size_t pos = m_buffer.find('\n', m_scan);
+            if (pos != std::string::npos) {
+                line.assign(m_buffer, m_start, pos - m_start);
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                m_start = m_scan = pos + 1;
+                return true;
+            }
+            m_scan = m_buffer.size();
+            if (m_start > 0 && m_start * 2 >= m_buffer.size()) {
+                m_buffer.erase(0, m_start);
+                m_scan -= m_start;
+                m_start = 0;
+            }
+
+            char chunk[65536];
+            ssize_t got = recv(m_fd, chunk, sizeof(chunk), 0);
+            if (got < 0 && errno == EINTR) continue;
+            if (got <= 0) return false;
+            m_buffer.append(chunk, static_cast<std::size_t>(got));
+        }
+    }
+
+private:
+    int m_fd;
+    std::string m_buffer;
+    std::size_t m_start = 0; // 下一行的起點
+    std::size_t m_scan = 0;  // 已確認不含 '\n' 的位置
+};
+
+// 完整寫出 (處理部分寫入)；對端已關閉時回傳 false，且不觸發 SIGPIPE
+bool sendAll(int fd, const std::string& data) {
+    std::size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        sent += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+struct SolveRequest {
+    std::string format = "coords";
+    double timeLimit = 0.0;
+    bool hasSeed = false;
+    unsigned int seed = 0;
+    int generations = 0;
+    int population = 0;
+    bool stream = true;
+    std::string publish; // 非空時同時發佈到此共享記憶體區段
+};
+
+// 解析 "SOLVE key=value ..." 的選項
+SolveRequest parseRequest(std::istringstream& header) {
+    SolveRequest request;
+    std::string token;
+    while (header >> token) {
+        std::size_t eq = token.find('=');
+        if (eq == std::string::npos) {
+            throw std::runtime_error("malformed option '" + token + "'");
+        }
+        std::string key = token.substr(0, eq);
+        std::string value = token.substr(eq + 1);
+        try {
+            if (key == "format") {
+                if (value != "coords" && value != "tsplib") throw std::runtime_error("unknown format '" + value + "'");
+                request.format = value;
+            } else if (key == "time") {
+                request.timeLimit = std::stod(value);
+            } else if (key == "seed") {
+                request.hasSeed = true;
+                request.seed = static_cast<unsigned int>(std::stoul(value));
+            } else if (key == "generations") {
+                request.generations = std::stoi(value);
+            } else if (key == "population") {
+                request.population = std::stoi(value);
+            } else if (key == "stream") {
+                request.stream = value != "0";
+            } else if (key == "publish") {
+                if (value.empty() || value.find('/', 1) != std::string::npos) {
+                    throw std::runtime_error("invalid segment name '" + value + "'");
+                }
+                request.publish = value;
+            } else {
+                throw std::runtime_error("unknown option '" + key + "'");
+            }
+        } catch (const std::logic_error&) {
+            // std::stod / std::stoi 的 invalid_argument 與 out_of_range
+            throw std::runtime_error("invalid value for '" + key + "'");
+        }
+    }
+    return request;
+}
+
+// coords 格式：每行一個城市 "x y"
+std::vector<City> parseCoordinates(const std::string& payload) {
+    std::vector<City> cities;
+    std::istringstream in(payload);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.find_first_not_of(" \t") == std::string::npos) continue;
+        std::istringstream fields(line);
+        double x, y;
+        if (!(fields >> x >> y)) {
+            throw std::runtime_error("invalid coordinate line '" + line + "'");
+        }
+        cities.push_back({static_cast<int>(cities.size()), x, y});
+    }
+    if (cities.empty()) {
+        throw std::runtime_error("instance has no cities");
+    }
+    return cities;
+}
+
+// "<標籤> [代數] <秒> <距離> <路徑...>"
+std::string formatTour(const char* tag, int generation, double seconds, const Individual& ind) {
+    std::ostringstream out;
+    out << tag;
+    if (generation >= 0) out << ' ' << generation;
+    out << ' ' << std::fixed << std::setprecision(4) << seconds << ' ' << std::setprecision(6) << ind.distance;
+    for (int city : ind.path) out << ' ' << city;
+    out << '\n';
+    return out.str();
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+[[noreturn]] void throwSocketError(const std::string& what, int fd) {
+    std::string message = "SolverDaemon: " + what + ": " + std::strerror(errno);
+    if (fd >= 0) close(fd);
+    throw std::runtime_error(message);
+}
+
+} // namespace
+
+SolverDaemon::SolverDaemon(const DaemonConfig& config)
+    : m_config(config), m_pool(config.workerCount) {}
+
+SolverDaemon::~SolverDaemon() {
+    stop();
+}
+
+void SolverDaemon::start() {
+    if (m_running) return;
+    if (m_config.unixPath.empty() && m_config.tcpPort < 0) {
+        throw std::runtime_error("SolverDaemon: no listen address configured.");
+    }
+
+    std::vector<int> fds;
+    try {
+        if (!m_config.unixPath.empty()) {
+            sockaddr_un addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sun_family = AF_UNIX;
+            if (m_config.unixPath.size() >= sizeof(addr.sun_path)) {
+                throw std::runtime_error("SolverDaemon: socket path is too long: " + m_config.unixPath);
+            }
+            std::strncpy(addr.sun_path, m_config.unixPath.c_str(), sizeof(addr.sun_path) - 1);
+
+            int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0) throwSocketError("socket", -1);
+            unlink(m_config.unixPath.c_str()); // 移除上次執行遺留的 socket 檔
+            if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) throwSocketError("bind " + m_config.unixPath, fd);
+            if (listen(fd, SOMAXCONN) < 0) throwSocketError("listen", fd);
+            fds.push_back(fd);
+        }
+
+        if (m_config.tcpPort >= 0) {
+            // 只綁定回送位址：服務僅供本機整合使用
+            sockaddr_in addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            addr.sin_port = htons(static_cast<std::uint16_t>(m_config.tcpPort));
+
+            int fd = socket(AF_INET, SOCK_STREAM, 0);
+            if (fd < 0) throwSocketError("socket", -1);
+            int one = 1;
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+            if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) throwSocketError("bind", fd);
+            if (listen(fd, SOMAXCONN) < 0) throwSocketError("listen", fd);
+
+            socklen_t len = sizeof(addr);
+            getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len);
+            m_boundPort = ntohs(addr.sin_port);
+            fds.push_back(fd);
+        }
+    } catch (...) {
+        for (int fd : fds) close(fd);
+        throw;
+    }
+
+    m_listenFds = std::move(fds);
+    m_running = true;
+    for (int fd : m_listenFds) {
+        m_acceptThreads.emplace_back(&SolverDaemon::acceptLoop, this, fd);
+    }
+}
+
+void SolverDaemon::stop() {
+    if (!m_running.exchange(false)) return;
+
+    // 1. 喚醒阻塞在 accept() 的執行緒並關閉監聽 socket
+    for (int fd : m_listenFds) {
+        shutdown(fd, SHUT_RDWR);
+    }
+    for (auto& t : m_acceptThreads) {
+        t.join();
+    }
+    m_acceptThreads.clear();
+    for (int fd : m_listenFds) {
+        close(fd);
+    }
+    m_listenFds.clear();
+    if (!m_config.unixPath.empty()) unlink(m_config.unixPath.c_str());
+    m_boundPort = -1;
+
+    // 2. 關閉既有連線 (讀取端立即返回)，等待處理中的請求結束
+    std::list<std::unique_ptr<Connection>> connections;
+    {
+        std::lock_guard<std::mutex> lock(m_connectionMutex);
+        for (auto& c : m_connections) {
+            c->cancel = true;
+            shutdown(c->fd, SHUT_RDWR);
+        }
+        connections.swap(m_connections);
+    }
+    for (auto& c : connections) {
+        c->thread.join();
+        close(c->fd);
+    }
+}
+
+SolverDaemon::Stats SolverDaemon::stats() const {
+    Stats s;
+    s.requests = m_requests.load();
+    s.cacheHits = m_cacheHits.load();
+    s.cacheMisses = m_cacheMisses.load();
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    s.cachedInstances = m_cache.size();
+    return s;
+}
+
+void SolverDaemon::acceptLoop(int listenFd) {
+    while (m_running) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            if (m_running && (errno == EINTR || errno == ECONNABORTED)) continue;
+            break;
+        }
+        // 串流的改善路徑應立即送出 (Unix-domain socket 不支援此選項，失敗可忽略)
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        reapConnections();
+        std::lock_guard<std::mutex> lock(m_connectionMutex);
+        if (!m_running) {
+            close(fd);
+            break;
+        }
+        m_connections.push_back(std::make_unique<Connection>());
+        Connection* connection = m_connections.back().get();
+        connection->fd = fd;
+        connection->thread = std::thread(&SolverDaemon::serveConnection, this, connection);
+    }
+}
+
+void SolverDaemon::reapConnections() {
+    std::list<std::unique_ptr<Connection>> finished;
+    {
+        std::lock_guard<std::mutex> lock(m_connectionMutex);
+        for (auto it = m_connections.begin(); it != m_connections.end();) {
+            auto current = it++;
+            if ((*current)->done) finished.splice(finished.end(), m_connections, current);
+        }
+    }
+    for (auto& c : finished) {
+        c->thread.join();
+        close(c->fd);
+    }
+}
+
+void SolverDaemon::serveConnection(Connection* connection) {
+    const int fd = connection->fd;
+    LineReader reader(fd);
+    std::string line;
+
+    while (m_running && reader.next(line)) {
+        std::istringstream header(line);
+        std::string command;
+        header >> command;
+        if (command.empty()) continue;
+
+        if (command == "PING") {
+            if (!sendAll(fd, "PONG\n")) break;
+            continue;
+        }
+        if (command == "STATS") {
+            Stats s = stats();
+            std::ostringstream out;
+            out << "STATS requests=" << s.requests << " hits=" << s.cacheHits << " misses=" << s.cacheMisses
+                << " instances=" << s.cachedInstances << '\n';
+            if (!sendAll(fd, out.str())) break;
+            continue;
+        }
+        if (command == "QUIT") break;
+        if (command != "SOLVE") {
+            if (!sendAll(fd, "ERROR unknown command '" + command + "'\n")) break;
+            continue;
+        }
+
+        // --- SOLVE：讀取實例內容直到 END ---
+        auto received = std::chrono::steady_clock::now();
+        std::string optionError;
+        SolveRequest request;
+        try {
+            request = parseRequest(header);
+        } catch (const std::exception& e) {
+            optionError = e.what();
+        }
+        std::string payload;
+        bool complete = false;
+        while (reader.next(line)) {
+            if (line == "END") {
+                complete = true;
+                break;
+            }
+            payload += line;
+            payload += '\n';
+        }
+        if (!complete) break;
+        if (!optionError.empty()) {
+            if (!sendAll(fd, "ERROR " + optionError + "\n")) break;
+            continue;
+        }
+        ++m_requests;
+
+        // 在常駐執行緒池上求解；本連線等待完成後才讀取下一個請求，因此回應不會交錯
+        std::promise<bool> finished;
+        m_pool.submit([this, connection, fd, &request, &payload, received, &finished]() {
+            bool connected = true;
+            // 對端已斷線時不再有人等待結果：設定取消旗標，讓求解於當代結束時返回
+            auto send = [fd, connection, &connected](const std::string& data) {
+                if (connected) connected = sendAll(fd, data);
+                if (!connected) connection->cancel = true;
+            };
+            try {
+                bool cached = false;
+                auto instance = lookupInstance(request.format, payload, cached);
+                int n = instance->cityCount();
+                send("ACCEPTED " + std::to_string(n) + (cached ? " cached\n" : " built\n"));
+
+                GAConfig config = m_config.makeConfig(n);
+                config.cityCount = n;
+                // 一個核心一個求解：關閉求解器內部的平行評估，避免巢狀平行化
+                config.useParallel = false;
+                config.stopFlag = &connection->cancel;
+                config.timeLimitSeconds = request.timeLimit;
+                if (request.population > 0) config.populationSize = request.population;
+                if (request.generations > 0) {
+                    config.generations = request.generations;
+                } else {
+                    // 未指定任何上限時改用服務的預設時間預算，避免以 makeConfig 的代數 (≈ 100n) 長時間佔住工作執行緒
+                    if (request.timeLimit <= 0.0) config.timeLimitSeconds = m_config.defaultTimeLimit;
+                    if (config.timeLimitSeconds > 0.0) config.generations = std::numeric_limits<int>::max(); // 只受時間預算限制
+                }
+                if (request.stream) {
+                    config.onBestImproved = [&send, received](int gen, const Individual& best) {
+                        send(formatTour("IMPROVED", gen, secondsSince(received), best));
+                    };
+                }
+                // 發佈區段保留到下一個同名請求覆寫為止，讓讀取端在求解結束後仍能取得最終結果
+                std::unique_ptr<TourPublisher> publisher;
+                if (!request.publish.empty()) {
+                    publisher = std::make_unique<TourPublisher>(request.publish, n, false);
+                    publisher->attach(config);
+                }
+                if (request.hasSeed) Utils::seed(request.seed);
+
+                GASolver solver(config, instance);
+                Individual best = solver.solve();
+                if (publisher) publisher->publish(-1, best, true);
+                send(formatTour("RESULT", -1, secondsSince(received), best));
+            } catch (const std::exception& e) {
+                send(std::string("ERROR ") + e.what() + "\n");
+            } catch (...) {
+                // 任何例外都必須走到 set_value，否則連線執行緒會永遠等待
+                send("ERROR unknown failure\n");
+            }
+            finished.set_value(connected);
+        });
+        if (!finished.get_future().get()) break;
+    }
+
+    // 通知對端連線結束；socket 由回收者在 join 之後關閉，避免與 stop() 競爭同一個 fd
+    shutdown(fd, SHUT_RDWR);
+    connection->done = true;
+}
+
+std::shared_ptr<const ProblemInstance> SolverDaemon::lookupInstance(const std::string& format,
+                                                                    const std::string& payload, bool& cached) {
+    std::string key = format + '\n' + payload;
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        auto it = m_cacheIndex.find(key);
+        if (it != m_cacheIndex.end()) {
+            m_cache.splice(m_cache.begin(), m_cache, it->second);
+            ++m_cacheHits;
+            cached = true;
+            return it->second->instance;
+        }
+    }
+
+    // 未命中：在鎖外解析並建表 (同一實例的並行請求可能各建一次，後到者改用已快取的版本)
+    ++m_cacheMisses;
+    cached = false;
+    std::vector<City> cities = format == "tsplib" ? TSPLIBParser::parseString(payload) : parseCoordinates(payload);
+    auto instance = ProblemInstance::create(cities, false, 1);
+    if (m_config.cacheCapacity == 0) return instance;
+
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    auto it = m_cacheIndex.find(key);
+    if (it != m_cacheIndex.end()) return it->second->instance;
+    m_cache.push_front({std::move(key), instance});
+    m_cacheIndex.emplace(m_cache.front().key, m_cache.begin());
+    while (m_cache.size() > m_config.cacheCapacity) {
+        m_cacheIndex.erase(m_cache.back().key);
+        m_cache.pop_back();
+    }
+    return instance;
+}
@@ -0,0 +1,241 @@
+#include "Service/TourPublisher.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr std::uint32_t kMagic = 0x47415453; // "GATS"
+constexpr std::uint32_t kLayoutVersion = 1;
+constexpr std::size_t kAlign = 64;           // 各區塊對齊快取行，避免寫入端與讀取端的偽共享
+
+// 跨行程共用的原子變數必須是無鎖 (address-free) 實作
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "shared-memory atomics must be lock-free");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "shared-memory atomics must be lock-free");
+static_assert(sizeof(int) == sizeof(std::int32_t), "tour entries are copied as int32");
+
+struct SharedHeader {
+    std::uint32_t magic;
+    std::uint32_t layoutVersion;
+    std::uint32_t capacity;
+    std::uint32_t reserved;
+    std::atomic<std::uint64_t> version; // 發佈次數
+    std::atomic<std::uint32_t> active;  // 最新完整的緩衝區索引
+};
+
+struct SharedSlot {
+    std::atomic<std::uint64_t> sequence; // Seqlock：奇數代表寫入中
+    std::int64_t generation;
+    double distance;
+    std::uint64_t timestampNs;
+    std::uint32_t count;
+    std::uint32_t final;
+    // 之後緊接 capacity 個 int32_t 的路徑
+};
+
+constexpr std::size_t alignUp(std::size_t bytes) {
+    return (bytes + kAlign - 1) / kAlign * kAlign;
+}
+
+std::size_t slotBytes(std::uint32_t capacity) {
+    return alignUp(sizeof(SharedSlot) + static_cast<std::size_t>(capacity) * sizeof(std::int32_t));
+}
+
+std::size_t regionBytes(std::uint32_t capacity) {
+    return alignUp(sizeof(SharedHeader)) + 2 * slotBytes(capacity);
+}
+
+SharedSlot* slotAt(void* base, std::uint32_t capacity, std::uint32_t index) {
+    char* p = static_cast<char*>(base) + alignUp(sizeof(SharedHeader)) + index * slotBytes(capacity);
+    return reinterpret_cast<SharedSlot*>(p);
+}
+
+const SharedSlot* slotAt(const void* base, std::uint32_t capacity, std::uint32_t index) {
+    return slotAt(const_cast<void*>(base), capacity, index);
+}
+
+std::int32_t* pathOf(SharedSlot* slot) {
+    return reinterpret_cast<std::int32_t*>(slot + 1);
+}
+
+std::string normalizeName(const std::string& name) {
+    return (!name.empty() && name[0] == '/') ? name : "/" + name;
+}
+
+[[noreturn]] void throwSystemError(const std::string& what) {
+    throw std::runtime_error("TourPublisher: " + what + ": " + std::strerror(errno));
+}
+
+} // namespace
+
+TourPublisher::TourPublisher(const std::string& name, int capacity, bool unlinkOnClose)
+    : m_name(normalizeName(name)), m_unlink(unlinkOnClose), m_capacity(static_cast<std::uint32_t>(std::max(capacity, 1))) {
+    m_size = regionBytes(m_capacity);
+    m_fd = shm_open(m_name.c_str(), O_CREAT | O_RDWR, 0644);
+    if (m_fd < 0) throwSystemError("shm_open " + m_name);
+    if (ftruncate(m_fd, static_cast<off_t>(m_size)) < 0) {
+        close(m_fd);
+        throwSystemError("ftruncate " + m_name);
+    }
+    m_base = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (m_base == MAP_FAILED) {
+        m_base = nullptr;
+        close(m_fd);
+        throwSystemError("mmap " + m_name);
+    }
+
+    // 初始化：先寫入欄位，最後才寫入 magic，讀取端以 magic 判斷區段是否就緒
+    auto* header = static_cast<SharedHeader*>(m_base);
+    header->magic = 0;
+    header->layoutVersion = kLayoutVersion;
+    header->capacity = m_capacity;
+    header->reserved = 0;
+    new (&header->version) std::atomic<std::uint64_t>(0);
+    new (&header->active) std::atomic<std::uint32_t>(0);
+    for (std::uint32_t s = 0; s < 2; ++s) {
+        SharedSlot* slot = slotAt(m_base, m_capacity, s);
+        new (&slot->sequence) std::atomic<std::uint64_t>(0);
+        slot->generation = -1;
+        slot->distance = 0.0;
+        slot->timestampNs = 0;
+        slot->count = 0;
+        slot->final = 0;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = kMagic;
+}
+
+TourPublisher::~TourPublisher() {
+    if (m_base) munmap(m_base, m_size);
+    if (m_fd >= 0) close(m_fd);
+    if (m_unlink) shm_unlink(m_name.c_str());
+}
+
+void TourPublisher::publish(std::int64_t generation, const Individual& best, bool final) {
+    if (best.path.size() > m_capacity) {
+        throw std::runtime_error("TourPublisher: tour of " + std::to_string(best.path.size()) +
+                                 " cities exceeds capacity " + std::to_string(m_capacity));
+    }
+    auto* header = static_cast<SharedHeader*>(m_base);
+
+    // 寫入非最新的緩衝區：正在讀取最新路徑的讀取端完全不受影響
+    std::uint32_t next = 1 - header->active.load(std::memory_order_relaxed);
+    SharedSlot* slot = slotAt(m_base, m_capacity, next);
+    std::uint64_t seq = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release); // 序號轉為奇數必須先於資料寫入被看見
+
+    slot->generation = generation;
+    slot->distance = best.distance;
+    slot->timestampNs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    slot->count = static_cast<std::uint32_t>(best.path.size());
+    slot->final = final ? 1 : 0;
+    std::memcpy(pathOf(slot), best.path.data(), best.path.size() * sizeof(std::int32_t));
+
+    slot->sequence.store(seq + 2, std::memory_order_release);
+    header->active.store(next, std::memory_order_release);
+    header->version.fetch_add(1, std::memory_order_release);
+}
+
+void TourPublisher::attach(GAConfig& config) {
+    auto previous = config.onBestImproved;
+    config.onBestImproved = [this, previous](int gen, const Individual& best) {
+        publish(gen, best);
+        if (previous) previous(gen, best);
+    };
+}
+
+TourReader::TourReader(const std::string& name) {
+    std::string shmName = normalizeName(name);
+    int fd = shm_open(shmName.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        throw std::runtime_error("TourReader: shm_open " + shmName + ": " + std::strerror(errno));
+    }
+    struct stat info;
+    if (fstat(fd, &info) < 0 || static_cast<std::size_t>(info.st_size) < alignUp(sizeof(SharedHeader))) {
+        close(fd);
+        throw std::runtime_error("TourReader: " + shmName + " is not a tour segment");
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+    void* base = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // 映射建立後即可關閉描述子
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("TourReader: mmap " + shmName + ": " + std::strerror(errno));
+    }
+    m_base = base;
+
+    const auto* header = static_cast<const SharedHeader*>(m_base);
+    if (header->magic != kMagic || header->layoutVersion != kLayoutVersion || regionBytes(header->capacity) > m_size) {
+        munmap(const_cast<void*>(m_base), m_size);
+        m_base = nullptr;
+        throw std::runtime_error("TourReader: " + shmName + " has an incompatible layout");
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+}
+
+TourReader::~TourReader() {
+    if (m_base) munmap(const_cast<void*>(m_base), m_size);
+}
+
+std::uint64_t TourReader::version() const {
+    return static_cast<const SharedHeader*>(m_base)->version.load(std::memory_order_acquire);
+}
+
+bool TourReader::acquire(TourView& view) const {
+    const auto* header = static_cast<const SharedHeader*>(m_base);
+    if (header->version.load(std::memory_order_acquire) == 0) return false;
+
+    std::uint32_t index = header->active.load(std::memory_order_acquire);
+    const SharedSlot* slot = slotAt(m_base, header->capacity, index);
+    std::uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+    if (seq & 1) return false;
+
+    view.generation = slot->generation;
+    view.distance = slot->distance;
+    view.timestampNs = slot->timestampNs;
+    view.final = slot->final != 0;
+    view.count = std::min(slot->count, header->capacity); // 防止讀到撕裂的長度時越界
+    view.path = reinterpret_cast<const std::int32_t*>(slot + 1);
+    view.slot = index;
+    view.sequence = seq;
+    return true;
+}
+
+bool TourReader::validate(const TourView& view) const {
+    const auto* header = static_cast<const SharedHeader*>(m_base);
+    std::atomic_thread_fence(std::memory_order_acquire); // 資料讀取必須先於序號的再次檢查
+    return slotAt(m_base, header->capacity, view.slot)->sequence.load(std::memory_order_relaxed) == view.sequence;
+}
+
+bool TourReader::read(TourSnapshot& snapshot) const {
+    // 寫入端只在發佈時短暫持有緩衝區，重試次數有限；寫入端行程中途終止時不會無限等待
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+        TourView view;
+        if (!acquire(view)) {
+            if (version() == 0) return false;
+            continue;
+        }
+        snapshot.path.assign(view.path, view.path + view.count);
+        if (!validate(view)) continue;
+        snapshot.generation = view.generation;
+        snapshot.distance = view.distance;
+        snapshot.timestampNs = view.timestampNs;
+        snapshot.final = view.final;
+        return true;
+    }
+    return false;
+}
+
+void TourReader::remove(const std::string& name) {
+    shm_unlink(normalizeName(name).c_str());
+}
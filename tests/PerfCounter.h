@@ -0,0 +1,81 @@
+#ifndef PERF_COUNTER_H
+#define PERF_COUNTER_H
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace GATestUtils {
+
+/**
+ * @class CacheMissCounter
+ * @brief 以 perf_event_open 計算硬體快取未命中次數 (Last-Level Cache Misses)
+ * * 計數範圍為呼叫執行緒及其之後建立的子執行緒 (inherit)，僅計使用者空間。
+ * 在容器、虛擬機或 perf_event_paranoid 限制下無法開啟時，available() 回傳 false，
+ * 呼叫端應改為只回報吞吐量。
+ */
+class CacheMissCounter {
+public:
+    CacheMissCounter() {
+#ifdef __linux__
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (m_fd >= 0) close(m_fd);
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    /** @brief 計數器是否可用 */
+    bool available() const { return m_fd >= 0; }
+
+    /** @brief 歸零並開始計數 */
+    void start() {
+#ifdef __linux__
+        if (m_fd < 0) return;
+        ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    /**
+     * @brief 停止計數並讀取結果
+     * @return 自 start() 以來的快取未命中次數 (不可用時為 0)
+     */
+    std::uint64_t stop() {
+        std::uint64_t value = 0;
+#ifdef __linux__
+        if (m_fd < 0) return 0;
+        ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(m_fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) value = 0;
+#endif
+        return value;
+    }
+
+private:
+    int m_fd = -1;
+};
+
+} // namespace GATestUtils
+
+#endif // PERF_COUNTER_H
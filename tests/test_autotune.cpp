@@ -0,0 +1,107 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include "Core/AutoTuner.h"
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：啟動時自動校準 ]
+ * 1. 校準結果合理：執行緒數、門檻、族群規模與 Memetic 強度皆在候選範圍內，且遵守時間預算。
+ * 2. 設定檔保存/讀取：同級距紀錄可讀回，不同級距互不覆寫。
+ * 3. 套用結果後求解：世代與穩態模式 (含 localSearchCount > 1) 皆產生合法路徑。
+ */
+
+static bool isValidTour(const std::vector<int>& path, int n) {
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return static_cast<int>(path.size()) == n;
+}
+
+int main() {
+    std::cout << "--- Auto-Tuner Test ---" << std::endl;
+
+    // 1. 校準
+    const int n = 60;
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    GAConfig base = GAConfig::generateDefault(n);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    TuningProfile profile = AutoTuner::calibrate(cities, base, 1.5);
+    double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << "  Threads       : " << profile.threadCount << std::endl;
+    std::cout << "  Par Threshold : " << profile.parallelThreshold << std::endl;
+    std::cout << "  Population    : " << profile.populationSize << std::endl;
+    std::cout << "  Local Search  : " << profile.localSearchCount << std::endl;
+    std::cout << "  Calibration   : " << elapsed << " s" << std::endl;
+
+    if (profile.cityCount != n || profile.threadCount < 1 || profile.parallelThreshold < 1 ||
+        profile.populationSize < 50 || profile.populationSize > 4 * std::max(100, n) ||
+        profile.localSearchCount < 1) {
+        std::cerr << "[TEST FAILED] Calibrated profile out of range." << std::endl;
+        return -1;
+    }
+    if (elapsed > 5.0) {
+        std::cerr << "[TEST FAILED] Calibration overran its budget (" << elapsed << " s)." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 1] Calibration: SUCCESS" << std::endl;
+
+    // 2. 設定檔保存與讀取
+    std::string path = "test_autotune.profile";
+    std::remove(path.c_str());
+    TuningProfile large = profile;
+    large.cityCount = 1000;
+    large.populationSize = 2000;
+    if (!AutoTuner::saveProfile(profile, path) || !AutoTuner::saveProfile(large, path)) {
+        std::cerr << "[TEST FAILED] Could not write profile." << std::endl;
+        return -1;
+    }
+
+    TuningProfile loaded;
+    if (!AutoTuner::loadProfile(path, n + 1, loaded) || loaded.populationSize != profile.populationSize ||
+        loaded.threadCount != profile.threadCount || loaded.localSearchCount != profile.localSearchCount) {
+        std::cerr << "[TEST FAILED] Profile round-trip mismatch." << std::endl;
+        return -1;
+    }
+    if (!AutoTuner::loadProfile(path, 1000, loaded) || loaded.populationSize != 2000) {
+        std::cerr << "[TEST FAILED] Size classes overwrote each other." << std::endl;
+        return -1;
+    }
+    if (AutoTuner::loadProfile(path, 10, loaded)) {
+        std::cerr << "[TEST FAILED] Loaded a profile for an unknown size class." << std::endl;
+        return -1;
+    }
+    std::remove(path.c_str());
+    std::cout << "[Step 2] Profile Persistence: SUCCESS" << std::endl;
+
+    // 3. 套用後求解 (強制 localSearchCount > 1 以涵蓋隨機子集 2-Opt)
+    for (bool steady : {false, true}) {
+        GAConfig config = GAConfig::generateDefault(n);
+        AutoTuner::apply(profile, config);
+        config.generations = 100;
+        config.localSearchCount = 8;
+        config.steadyState = steady;
+        config.rejectDuplicates = true;
+
+        GASolver solver(config, cities);
+        Individual best = solver.solve();
+        if (!isValidTour(best.path, n)) {
+            std::cerr << "[TEST FAILED] Tuned solve produced an invalid tour." << std::endl;
+            return -1;
+        }
+        std::cout << "  " << (steady ? "Steady-State " : "Generational ") << ": " << best.distance << std::endl;
+    }
+    std::cout << "[Step 3] Tuned Solve: SUCCESS" << std::endl;
+
+    std::cout << "All auto-tuner tests passed!" << std::endl;
+    return 0;
+}
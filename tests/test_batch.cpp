@@ -0,0 +1,91 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <iomanip>
+#include <algorithm>
+#include <numeric>
+#include <future>
+#include <stdexcept>
+#include "Core/BatchSolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：批次吞吐量模式驗證 ]
+ * 1. 完整性：每個實例都必須回傳一條合法的置換路徑 (Permutation)。
+ * 2. 即時回報：完成回呼的次數需與實例數相同，且每個索引恰好出現一次。
+ * 3. 吞吐量觀測：輸出整批的每秒完成實例數 (instances / s)。
+ * 4. 巢狀防護：在同一執行緒池的工作執行緒內呼叫 solveAll 必須立即拋出例外，而非死結。
+ */
+
+static bool isValidTour(const Individual& ind, std::size_t n) {
+    if (ind.path.size() != n) return false;
+    std::vector<int> sorted = ind.path;
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i < n; ++i) {
+        if (sorted[i] != static_cast<int>(i)) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "--- Batch Solver Throughput Test ---" << std::endl;
+
+    const int INSTANCE_COUNT = 16;
+
+    // 1. 準備一批 20–40 個城市的小型實例
+    std::vector<std::vector<City>> instances;
+    for (int i = 0; i < INSTANCE_COUNT; ++i) {
+        instances.push_back(Utils::generateRandomCities(20 + i, 1000.0, 1000.0));
+    }
+
+    // 2. 縮短演化代數，讓測試著重於排程而非收斂
+    auto makeConfig = [](int n) {
+        GAConfig config = GAConfig::generateDefault(n);
+        config.populationSize = 100;
+        config.generations = 200;
+        return config;
+    };
+
+    std::vector<int> reported(INSTANCE_COUNT, 0);
+    BatchSolver batch;
+    std::cout << "Workers: " << batch.workerCount() << std::endl;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto results = batch.solveAll(instances, makeConfig, [&](std::size_t idx, const Individual&) {
+        reported[idx]++;
+    });
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    // 3. 驗證結果
+    for (int i = 0; i < INSTANCE_COUNT; ++i) {
+        if (!isValidTour(results[i], instances[i].size())) {
+            std::cerr << "[TEST FAILED] Instance " << i << " returned an invalid tour." << std::endl;
+            return -1;
+        }
+        if (reported[i] != 1) {
+            std::cerr << "[TEST FAILED] Instance " << i << " reported " << reported[i] << " times." << std::endl;
+            return -1;
+        }
+    }
+
+    // 4. 巢狀呼叫：自池內任務再次呼叫 solveAll
+    std::promise<bool> rejected;
+    batch.submit([&]() {
+        try {
+            batch.solveAll({instances[0]}, makeConfig);
+            rejected.set_value(false);
+        } catch (const std::runtime_error&) {
+            rejected.set_value(true);
+        }
+    });
+    if (!rejected.get_future().get()) {
+        std::cerr << "[TEST FAILED] Nested solveAll on the same pool was not rejected." << std::endl;
+        return -1;
+    }
+
+    std::cout << "Batch Time  : " << std::fixed << std::setprecision(4) << seconds << " s" << std::endl;
+    std::cout << "Throughput  : " << std::setprecision(2) << INSTANCE_COUNT / seconds << " instances/s" << std::endl;
+    std::cout << "\n[TEST PASSED] All instances solved and reported exactly once." << std::endl;
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <iostream>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include "Core/HeldKarpBound.h"
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+#include "Parser/TSPLIBParser.h"
+
+/**
+ * [ 測試目的：Held-Karp 1-Tree 下界 ]
+ * 1. 合法性：小實例上下界不得超過暴力搜尋的最佳解，且應相當接近。
+ * 2. TSPLIB：berlin52 的下界需低於已知最佳迴路長度並在 3% 以內
+ *    (官方 7542 以四捨五入整數距離計算；本專案使用浮點距離，同一最佳迴路長 7544.366)。
+ * 3. 提前結束：求解器在背景計算下界，差距低於 targetGap 時提前停止。
+ *    使用最佳解已知的固定實例 (凸位置的點)，先驗證該迴路與下界的差距，再驗證求解器找到同一迴路後停止，
+ *    結果不受隨機抽樣影響。
+ */
+
+// 固定城市 0 為起點的暴力搜尋
+static double bruteForceOptimum(const std::vector<double>& matrix, int n) {
+    std::vector<int> perm(n - 1);
+    std::iota(perm.begin(), perm.end(), 1);
+    double best = 1e18;
+    do {
+        double len = matrix[perm[0]] + matrix[perm.back() * n];
+        for (int i = 0; i + 1 < n - 1; ++i) len += matrix[perm[i] * n + perm[i + 1]];
+        best = std::min(best, len);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    return best;
+}
+
+int main() {
+    std::cout << "--- Held-Karp Lower Bound Test ---" << std::endl;
+
+    // 1. 小實例與暴力解比對
+    for (int trial = 0; trial < 5; ++trial) {
+        const int n = 9;
+        auto cities = Utils::generateRandomCities(n, 100.0, 100.0);
+        auto matrix = Utils::precomputeDistanceMatrix(cities);
+        double optimum = bruteForceOptimum(matrix, n);
+        double bound = HeldKarpBound::compute(cities);
+        if (bound > optimum + 1e-6 || bound < 0.85 * optimum) {
+            std::cerr << "[TEST FAILED] Bound " << bound << " vs optimum " << optimum << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 1] Bound Validity (Brute Force): SUCCESS" << std::endl;
+
+    // 2. berlin52 (浮點距離下的最佳迴路長度)
+    const double berlinOptimum = 7544.3659;
+    auto berlin = TSPLIBParser::parse(std::string(TSPLIB_DATA_DIR) + "berlin52.tsp");
+    auto start = std::chrono::high_resolution_clock::now();
+    double bound = HeldKarpBound::compute(berlin);
+    double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    std::cout << "  berlin52 Bound: " << std::fixed << std::setprecision(2) << bound
+              << " (optimal " << berlinOptimum << ", " << elapsed << " s)" << std::endl;
+    if (bound > berlinOptimum + 1e-3 || bound < 0.97 * berlinOptimum) {
+        std::cerr << "[TEST FAILED] berlin52 bound out of range." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 2] TSPLIB Bound Quality: SUCCESS" << std::endl;
+
+    // 3. 提前結束 (固定實例：圓周上角度遞增的凸位置點，依索引順序的迴路即為最佳解)
+    const int m = 60;
+    std::vector<City> ring;
+    for (int i = 0; i < m; ++i) {
+        double angle = 2.0 * 3.14159265358979323846 * (i + 0.3 * std::sin(i)) / m;
+        ring.push_back({i, 500.0 + 400.0 * std::cos(angle), 500.0 + 400.0 * std::sin(angle)});
+    }
+    auto ringMatrix = Utils::precomputeDistanceMatrix(ring);
+    double ringOptimum = 0.0;
+    for (int i = 0; i < m; ++i) ringOptimum += ringMatrix[static_cast<std::size_t>(i) * m + (i + 1) % m];
+    double ringBound = HeldKarpBound::compute(ring);
+    double fixedGap = HeldKarpBound::gap(ringOptimum, ringBound);
+    std::cout << "  Ring Optimum  : " << ringOptimum << " (bound " << ringBound << ", gap " << fixedGap * 100.0
+              << "%)" << std::endl;
+
+    GAConfig config = GAConfig::generateDefault(m);
+    config.generations = 20000;
+    config.targetGap = 0.03;
+    int generationsRun = 0;
+    config.onGenerationComplete = [&generationsRun](int gen, double) { generationsRun = gen + 1; };
+
+    GASolver solver(config, ring);
+    Individual best = solver.solve();
+    double gap = HeldKarpBound::gap(best.distance, solver.getLowerBound());
+    std::cout << "  Best Distance : " << best.distance << std::endl;
+    std::cout << "  Lower Bound   : " << solver.getLowerBound() << std::endl;
+    std::cout << "  Certified Gap : " << gap * 100.0 << "% after " << generationsRun << " generations" << std::endl;
+
+    // 凸位置上 2-Opt 局部最優 (無交叉) 的迴路只有凸包順序，而求解器每代都會拋光最佳個體，
+    // 因此結果與抽樣無關：必定找到最佳解並在下界可用後停止
+    if (ringBound > ringOptimum + 1e-6 || fixedGap > config.targetGap ||
+        std::abs(best.distance - ringOptimum) > 1e-9 * ringOptimum ||
+        solver.getLowerBound() > best.distance + 1e-6 || gap > config.targetGap ||
+        generationsRun >= config.generations) {
+        std::cerr << "[TEST FAILED] Solver did not stop at the target gap." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 3] Early Stop at Target Gap: SUCCESS" << std::endl;
+
+    std::cout << "All lower bound tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,319 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "Service/SolverDaemon.h"
+#include "Service/TourPublisher.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：常駐求解服務 ]
+ * 1. Unix-domain socket：PING、串流回傳的改善路徑遞減且合法，最終結果一致並遵守時間預算。
+ * 2. 實例快取：相同實例的第二次請求命中快取，並輸出兩次請求的前置耗時 (數字僅供觀察)。
+ * 3. 回送 TCP：TSPLIB 文字請求、錯誤請求回應 ERROR 後連線仍可使用、相同種子結果可重現；
+ *    publish 請求結束後共享記憶體中保留與 RESULT 相同的最終路徑。
+ * 4. 並行與關閉：兩個連線同時求解 (其一未指定上限，套用預設時間預算)，
+ *    stop() 在連線仍開啟且有近乎無上限的求解進行中時，能於數秒內中止求解並返回。
+ */
+
+struct Reply {
+    std::vector<std::string> lines;
+    std::string last() const { return lines.empty() ? "" : lines.back(); }
+};
+
+class Client {
+public:
+    static Client unixSocket(const std::string& path) {
+        Client c;
+        c.m_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+        if (connect(c.m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) c.close();
+        return c;
+    }
+
+    static Client tcp(int port) {
+        Client c;
+        c.m_fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(static_cast<uint16_t>(port));
+        if (connect(c.m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) c.close();
+        return c;
+    }
+
+    Client() = default;
+    Client(Client&& other) noexcept : m_fd(other.m_fd), m_buffer(std::move(other.m_buffer)) { other.m_fd = -1; }
+    ~Client() { close(); }
+
+    bool connected() const { return m_fd >= 0; }
+
+    void close() {
+        if (m_fd >= 0) ::close(m_fd);
+        m_fd = -1;
+    }
+
+    bool send(const std::string& text) {
+        return m_fd >= 0 && ::send(m_fd, text.data(), text.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(text.size());
+    }
+
+    bool readLine(std::string& line) {
+        while (true) {
+            std::size_t pos = m_buffer.find('\n');
+            if (pos != std::string::npos) {
+                line = m_buffer.substr(0, pos);
+                m_buffer.erase(0, pos + 1);
+                return true;
+            }
+            char chunk[4096];
+            ssize_t got = m_fd >= 0 ? recv(m_fd, chunk, sizeof(chunk), 0) : -1;
+            if (got <= 0) return false;
+            m_buffer.append(chunk, static_cast<std::size_t>(got));
+        }
+    }
+
+    // 讀取回應直到 RESULT / ERROR (或連線結束)
+    Reply readReply() {
+        Reply reply;
+        std::string line;
+        while (readLine(line)) {
+            reply.lines.push_back(line);
+            if (line.rfind("RESULT", 0) == 0 || line.rfind("ERROR", 0) == 0) break;
+        }
+        return reply;
+    }
+
+private:
+    int m_fd = -1;
+    std::string m_buffer;
+};
+
+struct TourLine {
+    double seconds = 0.0;
+    double distance = 0.0;
+    std::vector<int> path;
+};
+
+// 解析 "IMPROVED <gen> <秒> <距離> <路徑...>" 或 "RESULT <秒> <距離> <路徑...>"
+static TourLine parseTour(const std::string& line) {
+    std::istringstream in(line);
+    std::string tag;
+    TourLine t;
+    in >> tag;
+    if (tag == "IMPROVED") {
+        int gen;
+        in >> gen;
+    }
+    in >> t.seconds >> t.distance;
+    int city;
+    while (in >> city) t.path.push_back(city);
+    return t;
+}
+
+static double tourLength(const std::vector<int>& path, const std::vector<City>& cities) {
+    double len = 0.0;
+    for (std::size_t i = 0; i < path.size(); ++i) {
+        const City& a = cities[path[i]];
+        const City& b = cities[path[(i + 1) % path.size()]];
+        len += std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+    }
+    return len;
+}
+
+static bool isValidTour(const std::vector<int>& path, int n) {
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return static_cast<int>(path.size()) == n;
+}
+
+static bool consistent(const TourLine& t, const std::vector<City>& cities) {
+    int n = static_cast<int>(cities.size());
+    return isValidTour(t.path, n) && std::abs(tourLength(t.path, cities) - t.distance) <= 1e-5 * t.distance + 1e-4;
+}
+
+static std::string coordsRequest(const std::vector<City>& cities, const std::string& options) {
+    std::ostringstream out;
+    out << "SOLVE " << options << '\n' << std::setprecision(17);
+    for (const City& c : cities) out << c.x << ' ' << c.y << '\n';
+    out << "END\n";
+    return out.str();
+}
+
+int main() {
+    std::cout << "--- Solver Daemon Test ---" << std::endl;
+
+    DaemonConfig config;
+    config.unixPath = "/tmp/ga_test_daemon_" + std::to_string(getpid()) + ".sock";
+    config.tcpPort = 0;
+    config.workerCount = 2;
+    config.cacheCapacity = 4;
+    config.defaultTimeLimit = 0.3;
+    SolverDaemon daemon(config);
+    daemon.start();
+
+    // 1. Unix-domain socket 與串流
+    const int n = 200;
+    const double budget = 0.5;
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    std::string request = coordsRequest(cities, "time=" + std::to_string(budget) + " seed=7");
+
+    Client client = Client::unixSocket(config.unixPath);
+    std::string line;
+    if (!client.send("PING\n") || !client.readLine(line) || line != "PONG") {
+        std::cerr << "[TEST FAILED] PING over the Unix socket." << std::endl;
+        return -1;
+    }
+    client.send(request);
+    Reply first = client.readReply();
+    if (first.lines.size() < 3 || first.lines[0] != "ACCEPTED 200 built" || first.last().rfind("RESULT", 0) != 0) {
+        std::cerr << "[TEST FAILED] Unexpected reply: " << first.last() << std::endl;
+        return -1;
+    }
+    double previous = 1e300;
+    for (std::size_t i = 1; i + 1 < first.lines.size(); ++i) {
+        TourLine t = parseTour(first.lines[i]);
+        if (first.lines[i].rfind("IMPROVED", 0) != 0 || t.distance >= previous || !consistent(t, cities)) {
+            std::cerr << "[TEST FAILED] Streamed tour " << i << " is not an improving valid tour." << std::endl;
+            return -1;
+        }
+        previous = t.distance;
+    }
+    TourLine result = parseTour(first.last());
+    if (!consistent(result, cities) || result.distance > previous + 1e-6 || result.seconds > budget + 5.0) {
+        std::cerr << "[TEST FAILED] Final result is inconsistent or ignored the time budget." << std::endl;
+        return -1;
+    }
+    std::cout << "  Streamed " << first.lines.size() - 2 << " improvements, final " << std::fixed
+              << std::setprecision(2) << result.distance << " after " << std::setprecision(3) << result.seconds
+              << " s (budget " << budget << " s)" << std::endl;
+    std::cout << "[Step 1] Unix Socket Streaming: SUCCESS" << std::endl;
+
+    // 2. 實例快取：較大的實例讓解析與建表成本明顯
+    auto large = Utils::generateRandomCities(2000, 1000.0, 1000.0);
+    std::string largeRequest = coordsRequest(large, "generations=1 population=16 stream=0");
+    double times[2];
+    Reply replies[2];
+    for (int r = 0; r < 2; ++r) {
+        auto start = std::chrono::high_resolution_clock::now();
+        client.send(largeRequest);
+        replies[r] = client.readReply();
+        times[r] = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+    client.send("STATS\n");
+    client.readLine(line);
+    if (replies[0].lines[0] != "ACCEPTED 2000 built" || replies[1].lines[0] != "ACCEPTED 2000 cached" ||
+        !consistent(parseTour(replies[1].last()), large) || line != "STATS requests=3 hits=1 misses=2 instances=2") {
+        std::cerr << "[TEST FAILED] Instance cache: " << replies[1].lines[0] << " / " << line << std::endl;
+        return -1;
+    }
+    std::cout << "  n = 2000, 1 generation, new instance    : " << std::setprecision(1) << times[0] * 1000.0
+              << " ms" << std::endl;
+    std::cout << "  n = 2000, 1 generation, cached instance : " << times[1] * 1000.0 << " ms" << std::endl;
+    std::cout << "[Step 2] Instance Cache: SUCCESS" << std::endl;
+
+    // 3. 回送 TCP：TSPLIB、錯誤處理與可重現性
+    std::ifstream file(std::string(TSPLIB_DATA_DIR) + "berlin52.tsp");
+    std::stringstream tsplib;
+    tsplib << file.rdbuf();
+    std::vector<City> berlin;
+    {
+        std::istringstream in(tsplib.str());
+        bool coords = false;
+        while (std::getline(in, line)) {
+            if (line.find("NODE_COORD_SECTION") != std::string::npos) { coords = true; continue; }
+            std::istringstream fields(line);
+            int id;
+            double x, y;
+            if (coords && fields >> id >> x >> y) berlin.push_back({id - 1, x, y});
+        }
+    }
+
+    Client tcp = Client::tcp(daemon.port());
+    tcp.send("SOLVE format=xyz\nEND\n");
+    Reply bad = tcp.readReply();
+    tcp.send("PING\n");
+    tcp.readLine(line);
+    if (bad.last().rfind("ERROR", 0) != 0 || line != "PONG") {
+        std::cerr << "[TEST FAILED] Malformed request was not rejected cleanly." << std::endl;
+        return -1;
+    }
+    std::string tsplibRequest = "SOLVE format=tsplib generations=40 seed=11 stream=0\n" + tsplib.str() + "\nEND\n";
+    tcp.send(tsplibRequest);
+    TourLine a = parseTour(tcp.readReply().last());
+    tcp.send(tsplibRequest);
+    TourLine b = parseTour(tcp.readReply().last());
+    if (!consistent(a, berlin) || a.distance != b.distance) {
+        std::cerr << "[TEST FAILED] TSPLIB request over TCP: " << a.distance << " vs " << b.distance << std::endl;
+        return -1;
+    }
+    std::cout << "  berlin52 (seed 11, 40 generations) : " << std::setprecision(2) << a.distance << std::endl;
+
+    std::string segment = "ga_test_daemon_" + std::to_string(getpid());
+    tcp.send(coordsRequest(cities, "generations=20 stream=0 publish=" + segment));
+    TourLine published = parseTour(tcp.readReply().last());
+    TourSnapshot snapshot;
+    try {
+        TourReader reader(segment);
+        if (!reader.read(snapshot)) snapshot.final = false;
+    } catch (const std::exception& e) {
+        std::cerr << "[TEST FAILED] " << e.what() << std::endl;
+        return -1;
+    }
+    TourReader::remove(segment);
+    if (!snapshot.final || snapshot.path != published.path || std::abs(snapshot.distance - published.distance) > 1e-5) {
+        std::cerr << "[TEST FAILED] Published segment does not hold the final result." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 3] TCP, TSPLIB, Seeding & Publishing: SUCCESS" << std::endl;
+
+    // 4. 並行求解與關閉
+    auto concurrent = [&config, &cities](const std::string& options) {
+        Client c = Client::unixSocket(config.unixPath);
+        c.send(coordsRequest(cities, options));
+        TourLine t = parseTour(c.readReply().last());
+        return consistent(t, cities);
+    };
+    auto f1 = std::async(std::launch::async, concurrent, "time=0.3 stream=0");
+    auto f2 = std::async(std::launch::async, concurrent, "stream=0"); // 預設時間預算
+    if (!f1.get() || !f2.get()) {
+        std::cerr << "[TEST FAILED] Concurrent requests returned invalid tours." << std::endl;
+        return -1;
+    }
+
+    // client 與 tcp 仍連線中，且 tcp 上有一個近乎無上限的求解
+    tcp.send(coordsRequest(cities, "generations=100000000 stream=0"));
+    tcp.readLine(line); // ACCEPTED：求解已開始
+    auto stopStart = std::chrono::high_resolution_clock::now();
+    daemon.stop();
+    double stopSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - stopStart).count();
+    if (client.readLine(line) || access(config.unixPath.c_str(), F_OK) == 0 || stopSeconds > 5.0) {
+        std::cerr << "[TEST FAILED] stop() left connections or the socket file behind, or waited " << stopSeconds
+                  << " s for the running solve." << std::endl;
+        return -1;
+    }
+    std::cout << "  stop() with a solve in flight : " << std::setprecision(1) << stopSeconds * 1000.0 << " ms"
+              << std::endl;
+    std::cout << "[Step 4] Concurrency & Shutdown: SUCCESS" << std::endl;
+
+    std::cout << "All solver daemon tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <algorithm>
+#include "Core/DecompositionSolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：大規模分解求解器 (Partition → Solve → Stitch) ]
+ * 1. 合法性：串接後的全域路徑必須恰好拜訪每個城市一次。
+ * 2. 品質：與隨機均勻分佈的 Beardwood–Halton–Hammersley 估計值
+ *    ($L^* \approx 0.7124 \sqrt{nA}$) 比較，誤差需在合理範圍內。
+ * 3. 效能觀測：輸出分群數與總耗時。
+ */
+
+int main() {
+    std::cout << "--- Decomposition Solver Test ---" << std::endl;
+
+    const int CITY_COUNT = 3000;
+    const double SIDE = 1000.0;
+    auto cities = Utils::generateRandomCities(CITY_COUNT, SIDE, SIDE);
+
+    DecompositionConfig config;
+    config.clusterSize = 150;
+    // 縮短子問題代數，讓測試著重於分解與串接流程
+    config.clusterConfig = [](int n) {
+        GAConfig ga = DecompositionConfig::clusterDefault(n);
+        ga.generations = 150;
+        return ga;
+    };
+
+    DecompositionSolver solver(config, cities);
+    auto start = std::chrono::high_resolution_clock::now();
+    Individual result = solver.solve();
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    // 1. 合法性
+    std::vector<int> sorted = result.path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < CITY_COUNT; ++i) {
+        if (static_cast<int>(sorted.size()) != CITY_COUNT || sorted[i] != i) {
+            std::cerr << "[TEST FAILED] Stitched tour is not a permutation." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 1] Tour Validity: SUCCESS" << std::endl;
+
+    // 2. 品質
+    double estimate = 0.7124 * std::sqrt(CITY_COUNT * SIDE * SIDE);
+    double ratio = result.distance / estimate;
+    std::cout << "  Clusters      : " << solver.getClusters().size() << std::endl;
+    std::cout << "  Tour Length   : " << std::fixed << std::setprecision(2) << result.distance << std::endl;
+    std::cout << "  BHH Estimate  : " << estimate << " (ratio " << ratio << ")" << std::endl;
+    std::cout << "  Time          : " << seconds << " s" << std::endl;
+    if (ratio > 1.5) {
+        std::cerr << "[TEST FAILED] Decomposed tour is too far from the expected optimum." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 2] Tour Quality: SUCCESS" << std::endl;
+
+    std::cout << "All decomposition tests passed!" << std::endl;
+    return 0;
+}
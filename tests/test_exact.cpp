@@ -0,0 +1,109 @@
+#include <iostream>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include "Core/ExactSolver.h"
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：位元遮罩 DP 精確解 ]
+ * 1. 正確性：與暴力搜尋比對最佳長度，並確認回傳路徑合法且長度一致。
+ * 2. 平行一致性與效能：平行與序列版本結果相同，並輸出各規模耗時。
+ * 3. 自動分派：GASolver 在 n <= exactThreshold 時直接回傳精確解。
+ */
+
+static double bruteForceOptimum(const std::vector<double>& matrix, int n) {
+    std::vector<int> perm(n - 1);
+    std::iota(perm.begin(), perm.end(), 1);
+    double best = 1e18;
+    do {
+        double len = matrix[perm[0]] + matrix[perm.back() * n];
+        for (int i = 0; i + 1 < n - 1; ++i) len += matrix[perm[i] * n + perm[i + 1]];
+        best = std::min(best, len);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+    return best;
+}
+
+static bool isValidTour(const std::vector<int>& path, int n) {
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return static_cast<int>(path.size()) == n;
+}
+
+static double tourLength(const std::vector<int>& path, const std::vector<double>& matrix, int n) {
+    double len = 0.0;
+    for (int i = 0; i < n; ++i) len += matrix[path[i] * n + path[(i + 1) % n]];
+    return len;
+}
+
+int main() {
+    std::cout << "--- Exact Solver Test ---" << std::endl;
+
+    // 1. 與暴力搜尋比對
+    for (int n = 1; n <= 10; ++n) {
+        auto cities = Utils::generateRandomCities(n, 100.0, 100.0);
+        auto matrix = Utils::precomputeDistanceMatrix(cities);
+        Individual exact = ExactSolver::solve(matrix, n);
+        double expected = (n == 1) ? 0.0 : bruteForceOptimum(matrix, n);
+
+        if (!isValidTour(exact.path, n) || std::abs(exact.distance - expected) > 1e-9 ||
+            std::abs(tourLength(exact.path, matrix, n) - exact.distance) > 1e-9) {
+            std::cerr << "[TEST FAILED] n = " << n << ": " << exact.distance << " vs " << expected << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 1] Optimality vs Brute Force: SUCCESS" << std::endl;
+
+    // 2. 平行一致性與耗時
+    for (int n : {12, 16, 18}) {
+        auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+        auto matrix = Utils::precomputeDistanceMatrix(cities);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        Individual parallel = ExactSolver::solve(matrix, n, true);
+        double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        Individual serial = ExactSolver::solve(matrix, n, false);
+
+        if (std::abs(parallel.distance - serial.distance) > 1e-9 || !isValidTour(parallel.path, n)) {
+            std::cerr << "[TEST FAILED] Parallel/serial mismatch at n = " << n << std::endl;
+            return -1;
+        }
+        std::cout << "  n = " << std::setw(2) << n << " : " << std::fixed << std::setprecision(2)
+                  << parallel.distance << " in " << elapsed * 1000.0 << " ms ("
+                  << ExactSolver::memoryRequired(n) / 1024 << " KB)" << std::endl;
+    }
+    std::cout << "[Step 2] Parallel Layers: SUCCESS" << std::endl;
+
+    // 3. GASolver 自動分派
+    const int n = 14;
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    auto matrix = Utils::precomputeDistanceMatrix(cities);
+    Individual expected = ExactSolver::solve(matrix, n);
+
+    GAConfig config = GAConfig::generateDefault(n);
+    int callbacks = 0;
+    config.onGenerationComplete = [&callbacks](int, double) { ++callbacks; };
+
+    auto start = std::chrono::high_resolution_clock::now();
+    GASolver solver(config, cities);
+    Individual best = solver.solve();
+    double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    if (std::abs(best.distance - expected.distance) > 1e-9 || callbacks != 1 ||
+        std::abs(solver.getOptimalityGap()) > 1e-12) {
+        std::cerr << "[TEST FAILED] GASolver did not dispatch to the exact solver." << std::endl;
+        return -1;
+    }
+    std::cout << "  GASolver n = " << n << " : " << best.distance << " in " << elapsed * 1000.0 << " ms" << std::endl;
+    std::cout << "[Step 3] Automatic Dispatch: SUCCESS" << std::endl;
+
+    std::cout << "All exact solver tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include <iostream>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include "Core/TourHash.h"
+#include "Core/FitnessCache.h"
+#include "Core/ParallelEvaluator.h"
+#include "Core/GASolver.h"
+#include "Core/FixedKernels.h"
+#include "Core/LocalSearch.h"
+#include "Core/TourConstructor.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：路徑雜湊、適應度快取與重複拒絕策略 ]
+ * 1. 不變性：旋轉與反向後的路徑雜湊值必須相同。
+ * 2. 增量更新：交換與 2-Opt 的 O(1) 增量、OX 子代由親代雜湊推得的結果 (各規模等級)，
+ *    以及 LocalSearch 各 2-Opt 版本隨移動累積的雜湊，皆須等於從頭計算的結果。
+ * 3. 快取正確性：命中快取的距離必須與直接計算完全一致。
+ * 4. 整合：開啟快取與重複拒絕後，求解器仍能找到正方形的最短路徑 40.0。
+ */
+
+int main() {
+    std::cout << "--- Tour Hash & Fitness Cache Test ---" << std::endl;
+
+    const int n = 60;
+    std::vector<int> path(n);
+    std::iota(path.begin(), path.end(), 0);
+    std::shuffle(path.begin(), path.end(), Utils::getGenerator());
+    std::uint64_t base = TourHash::compute(path);
+
+    // 1. 旋轉與方向不變性
+    std::vector<int> rotated = path;
+    std::rotate(rotated.begin(), rotated.begin() + 17, rotated.end());
+    std::vector<int> reversed(path.rbegin(), path.rend());
+    if (TourHash::compute(rotated) != base || TourHash::compute(reversed) != base) {
+        std::cerr << "[TEST FAILED] Hash is not rotation/direction invariant." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 1] Rotation & Direction Invariance: SUCCESS" << std::endl;
+
+    // 2. 增量更新 (交換突變 / 2-Opt 翻轉)
+    std::uint64_t hash = base;
+    for (int step = 0; step < 500; ++step) {
+        int i = Utils::getRandomInt(0, n - 1);
+        int j = Utils::getRandomInt(0, n - 1);
+        TourHash::swapCities(path, i, j, hash);
+        if (hash != TourHash::compute(path)) {
+            std::cerr << "[TEST FAILED] Incremental swap hash mismatch at step " << step << std::endl;
+            return -1;
+        }
+
+        int a = Utils::getRandomInt(1, n - 3);
+        int b = Utils::getRandomInt(a + 1, n - 2);
+        hash ^= TourHash::twoOptDelta(path[a - 1], path[a], path[b], path[b + 1]);
+        std::reverse(path.begin() + a, path.begin() + b + 1);
+        if (hash != TourHash::compute(path)) {
+            std::cerr << "[TEST FAILED] Incremental 2-Opt hash mismatch at step " << step << std::endl;
+            return -1;
+        }
+    }
+    // OX：短片段走增量路徑，長片段退回完整計算；涵蓋各規模等級與片段貼齊首尾的情況
+    for (int m : {60, 200, 800, 1500}) {
+        std::vector<int> p1(m), p2(m), child;
+        std::iota(p1.begin(), p1.end(), 0);
+        std::iota(p2.begin(), p2.end(), 0);
+        for (int trial = 0; trial < 200; ++trial) {
+            Utils::shuffle(p1.begin(), p1.end());
+            Utils::shuffle(p2.begin(), p2.end());
+            int len = Utils::getRandomInt(2, trial % 2 ? m - 1 : std::max(2, m / 4 - 1));
+            int start = (trial % 7 == 0) ? 0 : (trial % 7 == 1) ? m - len : Utils::getRandomInt(0, m - len);
+            std::uint64_t childHash = 0;
+            FixedKernels::crossoverOX(p1, p2, start, start + len - 1, child, &childHash, TourHash::compute(p2));
+            if (childHash != TourHash::compute(child)) {
+                std::cerr << "[TEST FAILED] OX child hash mismatch (n = " << m << ", segment [" << start << ", "
+                          << start + len - 1 << "])" << std::endl;
+                return -1;
+            }
+        }
+    }
+
+    // LocalSearch：近鄰清單、區塊化全鄰域與區段平行版本
+    {
+        const int m = 600;
+        auto pts = Utils::generateRandomCities(m, 1000.0, 1000.0);
+        auto dist = Utils::precomputeDistanceMatrix(pts);
+        auto lists = TourConstructor::buildCandidateLists(dist, m, 8);
+        for (int variant = 0; variant < 4; ++variant) {
+            std::vector<int> tour(m);
+            std::iota(tour.begin(), tour.end(), 0);
+            Utils::shuffle(tour.begin(), tour.end());
+            std::uint64_t tourHash = TourHash::compute(tour);
+            if (variant == 0) LocalSearch::twoOptNeighborList(tour, dist, m, lists, &tourHash);
+            if (variant == 1) LocalSearch::twoOptBlocked(tour, dist, m, &tourHash);
+            if (variant == 2) LocalSearch::twoOptParallel(tour, dist, m, lists, 4, &tourHash);
+            if (variant == 3) LocalSearch::twoOptParallel(tour, dist, m, {}, 4, &tourHash);
+            if (tourHash != TourHash::compute(tour)) {
+                std::cerr << "[TEST FAILED] 2-Opt variant " << variant << " left a stale hash." << std::endl;
+                return -1;
+            }
+        }
+    }
+    std::cout << "[Step 2] Incremental Updates: SUCCESS" << std::endl;
+
+    // 3. 快取評估結果需與直接計算一致，且重複路徑需命中
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    auto matrix = Utils::precomputeDistanceMatrix(cities);
+    std::vector<Individual> population(200);
+    for (size_t k = 0; k < population.size(); ++k) {
+        population[k].path = path;
+        if (k % 2 == 0) std::shuffle(population[k].path.begin(), population[k].path.end(), Utils::getGenerator());
+    }
+    std::vector<Individual> reference = population;
+
+    FitnessCache cache;
+    ParallelEvaluator evaluator;
+    evaluator.evaluate(population, matrix, n, true, &cache);
+    evaluator.evaluate(reference, matrix, n, false);
+    for (size_t k = 0; k < population.size(); ++k) {
+        if (population[k].distance != reference[k].distance) {
+            std::cerr << "[TEST FAILED] Cached distance mismatch at index " << k << std::endl;
+            return -1;
+        }
+    }
+    if (cache.hits() == 0) {
+        std::cerr << "[TEST FAILED] Duplicate tours never hit the cache." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 3] Fitness Cache (" << cache.hits() << " hits / " << cache.misses() << " misses): SUCCESS" << std::endl;
+
+    // 4. 求解器整合
+    std::vector<City> square = {
+        {0, 0.0, 0.0}, {1, 0.0, 10.0}, {2, 10.0, 10.0}, {3, 10.0, 0.0}
+    };
+    for (bool steady : {false, true}) {
+        GAConfig config = GAConfig::generateDefault(4);
+        config.generations = 50;
+        config.useFitnessCache = true;
+        config.rejectDuplicates = true;
+        config.steadyState = steady;
+        config.exactThreshold = 0; // 關閉精確解分派，確保走演化流程
+
+        GASolver solver(config, square);
+        Individual best = solver.solve();
+        if (best.distance > 40.0001) {
+            std::cerr << "[TEST FAILED] Solver with duplicate rejection converged to " << best.distance << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 4] Solver Integration: SUCCESS" << std::endl;
+
+    std::cout << "All hash tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "Core/PopulationHeap.h"
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：索引式最小-最大堆積與穩態演化模式 ]
+ * 1. 堆積正確性：隨機更新鍵值後，minIndex / maxIndex 必須與暴力搜尋結果一致。
+ * 2. 穩態模式整合：在正方形佈局上，穩態模式同樣需找到理論最短路徑 40.0。
+ */
+
+int main() {
+    std::cout << "--- Population Heap & Steady-State Test ---" << std::endl;
+
+    // 1. 隨機鍵值更新與暴力比對
+    for (int size : {1, 2, 3, 7, 64, 257}) {
+        std::vector<Individual> population(size);
+        for (auto& ind : population) ind.distance = Utils::getRandomDouble(0.0, 1000.0);
+
+        PopulationHeap heap;
+        heap.build(population);
+
+        for (int step = 0; step < 2000; ++step) {
+            int idx = Utils::getRandomInt(0, size - 1);
+            population[idx].distance = Utils::getRandomDouble(0.0, 1000.0);
+            heap.update(idx, population[idx].distance);
+
+            auto cmp = [](const Individual& a, const Individual& b) { return a.distance < b.distance; };
+            double expectMin = std::min_element(population.begin(), population.end(), cmp)->distance;
+            double expectMax = std::max_element(population.begin(), population.end(), cmp)->distance;
+
+            if (heap.key(heap.minIndex()) != expectMin || heap.key(heap.maxIndex()) != expectMax) {
+                std::cerr << "[TEST FAILED] Heap order violated (size " << size << ", step " << step << ")" << std::endl;
+                return -1;
+            }
+        }
+    }
+    std::cout << "[Step 1] Indexed Min-Max Heap: SUCCESS" << std::endl;
+
+    // 2. 穩態模式求解正方形佈局
+    std::vector<City> cities = {
+        {0, 0.0, 0.0}, {1, 0.0, 10.0}, {2, 10.0, 10.0}, {3, 10.0, 0.0}
+    };
+    for (ReplacementPolicy policy : {ReplacementPolicy::Worst, ReplacementPolicy::TournamentLoser}) {
+        GAConfig config = GAConfig::generateDefault(4);
+        config.generations = 50;
+        config.steadyState = true;
+        config.replacement = policy;
+        config.exactThreshold = 0; // 關閉精確解分派，確保走演化流程
+
+        GASolver solver(config, cities);
+        Individual best = solver.solve();
+        if (best.distance > 40.0001 || solver.getBestIndividual().distance > 40.0001) {
+            std::cerr << "[TEST FAILED] Steady-state converged to " << best.distance << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 2] Steady-State Solve: SUCCESS" << std::endl;
+
+    std::cout << "All heap tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include "Core/HugePageArena.h"
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：大分頁配置區與記憶體用量報告 ]
+ * 1. 配置區：位址對齊、容量向上取整至 2 MB、空間不足時回傳 nullptr，reset() 後可重新配置。
+ * 2. 配置器：容器元素位於配置區內，配置區用盡時退回一般堆積，未指定配置區時等同 std::allocator。
+ * 3. 求解器：啟用 useHugePages 的結果合法，記憶體報告各分項與容器大小一致、估計值不低於實際用量，
+ *    並輸出分頁方式與啟用前後的求解耗時 (大分頁是否可用取決於核心設定，數字僅供觀察)。
+ * 4. 配置區門檻：演化暫存未達 2 MB 時不建立配置區，達到時才建立，且報告只計已配置的位元組。
+ */
+
+static bool isValidTour(const std::vector<int>& path, int n) {
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return static_cast<int>(path.size()) == n;
+}
+
+int main() {
+    std::cout << "--- Huge Page Arena Test ---" << std::endl;
+
+    // 1. 配置區
+    {
+        HugePageArena arena(3 << 20);
+        void* a = arena.allocate(100);
+        void* b = arena.allocate(1000, 4096);
+        if (arena.capacity() != 2 * HugePageArena::kHugePageSize || !a || !b ||
+            reinterpret_cast<std::uintptr_t>(a) % 64 != 0 || reinterpret_cast<std::uintptr_t>(b) % 4096 != 0 ||
+            !arena.owns(a) || !arena.owns(b) || arena.used() < 4096 + 1000) {
+            std::cerr << "[TEST FAILED] Arena alignment or bookkeeping is wrong." << std::endl;
+            return -1;
+        }
+        // 整段寫入，確認映射可用
+        std::size_t rest = arena.capacity() - arena.used() - 64;
+        char* all = static_cast<char*>(arena.allocate(rest, 1));
+        if (!all) {
+            std::cerr << "[TEST FAILED] Remaining capacity could not be allocated." << std::endl;
+            return -1;
+        }
+        std::fill(all, all + rest, 1);
+        if (arena.allocate(128) != nullptr) {
+            std::cerr << "[TEST FAILED] Exhausted arena still returned memory." << std::endl;
+            return -1;
+        }
+        arena.reset();
+        if (arena.allocate(128) != a) {
+            std::cerr << "[TEST FAILED] reset() did not rewind the arena." << std::endl;
+            return -1;
+        }
+        std::cout << "  4 MB arena backed by " << HugePageArena::backingName(arena.backing()) << std::endl;
+    }
+    std::cout << "[Step 1] Arena Allocation: SUCCESS" << std::endl;
+
+    // 2. 配置器
+    {
+        HugePageArena arena(1);
+        std::vector<double, ArenaAllocator<double>> inside{ArenaAllocator<double>(&arena)};
+        inside.reserve(1000);
+        inside.assign(1000, 2.5);
+        std::vector<double, ArenaAllocator<double>> overflow{ArenaAllocator<double>(&arena)};
+        overflow.assign(HugePageArena::kHugePageSize / sizeof(double), 1.0); // 超過剩餘空間
+        std::vector<int, ArenaAllocator<int>> plain;
+        plain.assign(100, 7);
+        if (!arena.owns(inside.data()) || arena.owns(overflow.data()) || plain.get_allocator().arena() != nullptr ||
+            std::accumulate(inside.begin(), inside.end(), 0.0) != 2500.0 || plain[99] != 7) {
+            std::cerr << "[TEST FAILED] ArenaAllocator placed data in the wrong place." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 2] Arena Allocator & Fallback: SUCCESS" << std::endl;
+
+    // 3. 求解器
+    {
+        const int n = 1500;
+        auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+        GAConfig config = GAConfig::generateDefault(n);
+        config.populationSize = 200;
+        config.generations = 20;
+        config.selectionMode = SelectionMode::StochasticUniversal;
+
+        double times[2];
+        Individual results[2];
+        for (int run = 0; run < 2; ++run) {
+            config.useHugePages = run == 1;
+            auto start = std::chrono::high_resolution_clock::now();
+            GASolver solver(config, cities);
+            results[run] = solver.solve();
+            times[run] = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+            if (run == 0) continue;
+
+            MemoryFootprint actual = solver.getMemoryFootprint();
+            MemoryFootprint estimate = GASolver::estimateFootprint(config);
+            std::size_t matrixBytes = static_cast<std::size_t>(n) * n * sizeof(double);
+            std::size_t pathBytes = static_cast<std::size_t>(config.populationSize) * n * sizeof(int);
+            // 演化暫存遠小於 2 MB，不應為它保留整個大分頁
+            if (actual.distanceTable < matrixBytes || actual.population < pathBytes ||
+                actual.scratch >= HugePageArena::kHugePageSize || estimate.distanceTable != matrixBytes ||
+                estimate.population < actual.population || estimate.neighborLists < actual.neighborLists ||
+                actual.total() != actual.distanceTable + actual.neighborLists + actual.population + actual.scratch) {
+                std::cerr << "[TEST FAILED] Footprint report is inconsistent with the solver state." << std::endl;
+                return -1;
+            }
+            std::cout << solver.getMemoryFootprintReport();
+        }
+        if (!isValidTour(results[1].path, n)) {
+            std::cerr << "[TEST FAILED] Solver with huge pages returned an invalid tour." << std::endl;
+            return -1;
+        }
+        std::cout << "  4 KB pages  : " << std::fixed << std::setprecision(2) << results[0].distance << " ("
+                  << std::setprecision(3) << times[0] << " s)" << std::endl;
+        std::cout << "  Huge pages  : " << std::setprecision(2) << results[1].distance << " (" << std::setprecision(3)
+                  << times[1] << " s)" << std::endl;
+    }
+    std::cout << "[Step 3] Solver Footprint Report: SUCCESS" << std::endl;
+
+    // 4. 暫存達 2 MB 的族群才建立配置區，報告計入已配置的位元組而非整段容量
+    {
+        const int n = 20;
+        auto cities = Utils::generateRandomCities(n, 100.0, 100.0);
+        GAConfig config = GAConfig::generateDefault(n);
+        config.populationSize = 200000;
+        config.useHugePages = true;
+        GASolver solver(config, cities);
+        MemoryFootprint actual = solver.getMemoryFootprint();
+        MemoryFootprint estimate = GASolver::estimateFootprint(config);
+        std::size_t keyBytes = static_cast<std::size_t>(config.populationSize) * sizeof(std::pair<double, int>);
+        std::string report = solver.getMemoryFootprintReport();
+        if (actual.scratch < keyBytes || actual.scratch > estimate.scratch ||
+            report.find("arena:") == std::string::npos) {
+            std::cerr << "[TEST FAILED] Large scratch buffers should live in the arena and report used bytes." << std::endl;
+            return -1;
+        }
+        std::cout << report;
+    }
+    std::cout << "[Step 4] Arena Threshold & Used Bytes: SUCCESS" << std::endl;
+
+    std::cout << "All huge page arena tests passed!" << std::endl;
+    return 0;
+}
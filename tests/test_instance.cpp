@@ -0,0 +1,148 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <stdexcept>
+#include "Core/GASolver.h"
+#include "Core/ProblemInstance.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：共享唯讀實例 (ProblemInstance) ]
+ * 1. 共享：以同一實例建構的多個求解器使用同一份距離矩陣，且可在多個執行緒同時求解
+ *    (近鄰清單由第一次取用者建立，其餘執行緒直接共用)。
+ * 2. 寫入時複製：resolve() 套用變更後求解器改用新實例，原實例與其他持有者不受影響。
+ * 3. 重新編號：Hilbert 編號的實例輸出原始城市索引，城市數不符時拋出例外。
+ * 4. 前置成本：比較每個求解器各自建矩陣與共用實例的建構耗時，數字僅供觀察。
+ */
+
+static bool isValidTour(const std::vector<int>& path, int n) {
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return static_cast<int>(path.size()) == n;
+}
+
+static double tourLength(const std::vector<int>& path, const std::vector<double>& matrix, int n) {
+    double len = 0.0;
+    for (int i = 0; i < n; ++i) len += matrix[static_cast<std::size_t>(path[i]) * n + path[(i + 1) % n]];
+    return len;
+}
+
+int main() {
+    std::cout << "--- Shared Problem Instance Test ---" << std::endl;
+
+    const int n = 300;
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    auto instance = ProblemInstance::create(cities);
+    auto matrix = Utils::precomputeDistanceMatrix(cities);
+
+    GAConfig config = GAConfig::generateDefault(n);
+    config.populationSize = 200;
+    config.generations = 30;
+    config.useParallel = false;
+    config.neighborListThreshold = 100; // 讓求解器取用共享的近鄰清單
+
+    // 1. 多個求解器、多個執行緒共用同一實例
+    std::vector<std::future<double>> futures;
+    for (int t = 0; t < 4; ++t) {
+        futures.push_back(std::async(std::launch::async, [&config, instance, &matrix]() {
+            GASolver solver(config, instance);
+            if (solver.getInstance()->distances().data() != instance->distances().data()) return -1.0;
+            Individual best = solver.solve();
+            if (!isValidTour(best.path, n) ||
+                std::abs(tourLength(best.path, matrix, n) - best.distance) > 1e-6 * best.distance) {
+                return -1.0;
+            }
+            return best.distance;
+        }));
+    }
+    for (auto& f : futures) {
+        if (f.get() < 0.0) {
+            std::cerr << "[TEST FAILED] Concurrent solve on a shared instance was inconsistent." << std::endl;
+            return -1;
+        }
+    }
+    if (!instance->hasNeighbors() || static_cast<int>(instance->neighbors().size()) != n ||
+        instance->distances() != matrix) {
+        std::cerr << "[TEST FAILED] Shared instance was not built or was modified." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 1] Concurrent Sharing: SUCCESS" << std::endl;
+
+    // 2. 寫入時複製
+    GASolver owner(config, instance);
+    owner.solve();
+    InstanceDelta delta;
+    delta.added = Utils::generateRandomCities(3, 1000.0, 1000.0);
+    delta.removed = {0, 5};
+    delta.moved = {{7, 1.0, 2.0}};
+    Individual repaired = owner.resolve(delta, 5);
+    int newN = n + 1;
+    auto newMatrix = Utils::precomputeDistanceMatrix(owner.getCities());
+    if (owner.getInstance() == instance || owner.getInstance()->cityCount() != newN ||
+        instance->cityCount() != n || instance->distances() != matrix ||
+        !isValidTour(repaired.path, newN) ||
+        std::abs(tourLength(repaired.path, newMatrix, newN) - repaired.distance) > 1e-6 * repaired.distance) {
+        std::cerr << "[TEST FAILED] resolve() did not copy the shared instance on write." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 2] Copy-on-Write Resolve: SUCCESS" << std::endl;
+
+    // 3. 重新編號的實例與錯誤處理
+    auto renumbered = ProblemInstance::create(cities, true);
+    GASolver hilbert(config, renumbered);
+    Individual best = hilbert.solve();
+    if (renumbered->cityOrder().empty() || !isValidTour(best.path, n) ||
+        std::abs(tourLength(best.path, matrix, n) - best.distance) > 1e-6 * best.distance) {
+        std::cerr << "[TEST FAILED] Renumbered instance did not map tours back." << std::endl;
+        return -1;
+    }
+    bool threw = false;
+    try {
+        GAConfig wrong = GAConfig::generateDefault(n + 1);
+        GASolver mismatched(wrong, instance);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    if (!threw) {
+        std::cerr << "[TEST FAILED] City count mismatch was not rejected." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 3] Renumbering & Validation: SUCCESS" << std::endl;
+
+    // 4. 前置成本：各自建構 vs 共用實例
+    const int largeN = 2000;
+    const int solvers = 8;
+    auto largeCities = Utils::generateRandomCities(largeN, 1000.0, 1000.0);
+    GAConfig largeConfig = GAConfig::generateDefault(largeN);
+    largeConfig.populationSize = 64;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int s = 0; s < solvers; ++s) {
+        GASolver solver(largeConfig, largeCities);
+    }
+    double privateTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    auto shared = ProblemInstance::create(largeCities);
+    for (int s = 0; s < solvers; ++s) {
+        GASolver solver(largeConfig, shared);
+    }
+    double sharedTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << "  " << solvers << " solvers, n = " << largeN << std::endl;
+    std::cout << "  Private Matrices : " << std::fixed << std::setprecision(4) << privateTime << " s, "
+              << std::setprecision(1) << solvers * 8.0 * largeN * largeN / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "  Shared Instance  : " << std::setprecision(4) << sharedTime << " s, "
+              << std::setprecision(1) << 8.0 * largeN * largeN / (1024 * 1024) << " MB" << std::endl;
+    std::cout << "[Step 4] Setup Cost: SUCCESS" << std::endl;
+
+    std::cout << "All shared instance tests passed!" << std::endl;
+    return 0;
+}
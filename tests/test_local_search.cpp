@@ -0,0 +1,233 @@
+#include <iostream>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include "Core/TwoLevelList.h"
+#include "Core/LocalSearch.h"
+#include "Core/TourConstructor.h"
+#include "Core/ParallelEvaluator.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：局部搜尋核心與兩層式路徑表示 ]
+ * 1. TwoLevelList 正確性：隨機翻轉後，next / prev / sequence / between 需與一般陣列版本一致
+ *    (封閉迴路比對需忽略起點與方向)。
+ * 2. 近鄰 2-Opt：結果需為合法置換，且回報的增益需等於實際距離差。
+ * 3. 區塊化全鄰域 2-Opt：結果需為合法置換、增益正確且為 2-Opt 局部最優，
+ *    並與原本的純量首次改善迴圈比較耗時 (僅供觀察)。
+ * 4. 區段平行 2-Opt：由最近鄰居路徑出發 (模擬最終拋光)，強制多個區段以驗證無衝突套用，
+ *    結果需為合法置換且增益正確。全鄰域模式需為 2-Opt 局部最優；近鄰模式的 Don't-Look Bits
+ *    只重新檢查端點，序列版本本身也非完全收斂，因此改為要求品質與序列版本相差 1% 以內
+ *    (以固定種子產生實例，結果可重現)。
+ */
+
+// 將封閉迴路正規化：從城市 0 出發，並選擇第二個城市編號較小的方向
+static std::vector<int> canonical(const std::vector<int>& path) {
+    int n = static_cast<int>(path.size());
+    int p0 = static_cast<int>(std::find(path.begin(), path.end(), 0) - path.begin());
+    std::vector<int> out(n);
+    bool forward = path[(p0 + 1) % n] < path[(p0 - 1 + n) % n];
+    for (int k = 0; k < n; ++k) {
+        out[k] = forward ? path[(p0 + k) % n] : path[(p0 - k + n) % n];
+    }
+    return out;
+}
+
+static double tourLength(const std::vector<int>& path, const std::vector<double>& matrix, int n) {
+    std::vector<Individual> one(1);
+    one[0].path = path;
+    ParallelEvaluator evaluator;
+    evaluator.evaluate(one, matrix, n, false);
+    return one[0].distance;
+}
+
+// GASolver::apply2Opt 原本的純量首次改善迴圈
+static double scalarTwoOpt(std::vector<int>& path, const std::vector<double>& matrix, int n) {
+    double gain = 0.0;
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (int i = 1; i < n - 2; ++i) {
+            for (int j = i + 1; j < n - 1; ++j) {
+                double oldDist = matrix[path[i - 1] * n + path[i]] + matrix[path[j] * n + path[j + 1]];
+                double newDist = matrix[path[i - 1] * n + path[j]] + matrix[path[i] * n + path[j + 1]];
+                if (newDist < oldDist - 1e-10) {
+                    std::reverse(path.begin() + i, path.begin() + j + 1);
+                    gain += oldDist - newDist;
+                    improved = true;
+                }
+            }
+        }
+    }
+    return gain;
+}
+
+int main() {
+    std::cout << "--- Local Search Kernel Test ---" << std::endl;
+    // 固定種子：實例與隨機路徑每次相同，品質比較不受抽樣影響 (區段平行版本的結果與排程無關)
+    Utils::seed(2024);
+
+    // 1. TwoLevelList 與陣列版翻轉比對
+    for (int n : {5, 17, 100, 1000}) {
+        std::vector<int> reference(n);
+        std::iota(reference.begin(), reference.end(), 0);
+        std::shuffle(reference.begin(), reference.end(), Utils::getGenerator());
+        TwoLevelList list(reference);
+
+        for (int step = 0; step < 3000; ++step) {
+            // 翻轉可能改變整體走訪方向，因此每一步都以目前的 toPath() 作為參考版起點
+            reference = list.toPath();
+            int i = Utils::getRandomInt(0, n - 1);
+            int j = Utils::getRandomInt(0, n - 1);
+            int a = reference[i], b = reference[j];
+
+            // 參考版：翻轉從 a 到 b 的順向子路徑 (可繞過尾端)
+            int len = (j - i + n) % n + 1;
+            for (int k = 0; k < len / 2; ++k) {
+                std::swap(reference[(i + k) % n], reference[(i + len - 1 - k) % n]);
+            }
+            list.reverse(a, b);
+
+            std::vector<int> path = list.toPath();
+            if (canonical(path) != canonical(reference)) {
+                std::cerr << "[TEST FAILED] TwoLevelList diverged (n = " << n << ", step " << step << ")" << std::endl;
+                return -1;
+            }
+            for (int k = 0; k < n; ++k) {
+                int c = path[k];
+                if (list.sequence(c) != k || list.next(c) != path[(k + 1) % n] ||
+                    list.prev(c) != path[(k - 1 + n) % n]) {
+                    std::cerr << "[TEST FAILED] TwoLevelList navigation mismatch (n = " << n << ")" << std::endl;
+                    return -1;
+                }
+            }
+            if (!list.between(path[0], path[n / 2], path[n - 1]) || list.between(path[1], path[0], path[n / 2])) {
+                std::cerr << "[TEST FAILED] TwoLevelList between() mismatch (n = " << n << ")" << std::endl;
+                return -1;
+            }
+        }
+    }
+    std::cout << "[Step 1] Two-Level List Reversal: SUCCESS" << std::endl;
+
+    // 2. 近鄰 2-Opt (由隨機路徑出發)
+    const int n = 5000;
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    auto matrix = Utils::precomputeDistanceMatrix(cities);
+    auto neighbors = TourConstructor::buildCandidateLists(matrix, n, 8);
+
+    std::vector<int> path(n);
+    std::iota(path.begin(), path.end(), 0);
+    std::shuffle(path.begin(), path.end(), Utils::getGenerator());
+    double before = tourLength(path, matrix, n);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    double gain = LocalSearch::twoOptNeighborList(path, matrix, n, neighbors);
+    auto end = std::chrono::high_resolution_clock::now();
+    double after = tourLength(path, matrix, n);
+
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) {
+            std::cerr << "[TEST FAILED] Neighbor-list 2-Opt produced an invalid tour." << std::endl;
+            return -1;
+        }
+    }
+    if (std::abs((before - after) - gain) > 1e-6 * before) {
+        std::cerr << "[TEST FAILED] Reported gain " << gain << " != actual " << before - after << std::endl;
+        return -1;
+    }
+    std::cout << "  Random Tour   : " << std::fixed << std::setprecision(2) << before << std::endl;
+    std::cout << "  After 2-Opt   : " << after << " ("
+              << std::chrono::duration<double>(end - start).count() << " s)" << std::endl;
+    std::cout << "[Step 2] Neighbor-List 2-Opt: SUCCESS" << std::endl;
+
+    // 3. 區塊化全鄰域 2-Opt vs 純量迴圈
+    for (int m : {4, 7, 200, 1000}) {
+        auto midCities = Utils::generateRandomCities(m, 1000.0, 1000.0);
+        auto midMatrix = Utils::precomputeDistanceMatrix(midCities);
+        std::vector<int> blocked(m);
+        std::iota(blocked.begin(), blocked.end(), 0);
+        std::shuffle(blocked.begin(), blocked.end(), Utils::getGenerator());
+        std::vector<int> scalar = blocked;
+        double initial = tourLength(blocked, midMatrix, m);
+
+        auto t0 = std::chrono::high_resolution_clock::now();
+        double blockedGain = LocalSearch::twoOptBlocked(blocked, midMatrix, m);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        scalarTwoOpt(scalar, midMatrix, m);
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        std::vector<int> check = blocked;
+        std::sort(check.begin(), check.end());
+        bool valid = true;
+        for (int i = 0; i < m; ++i) valid = valid && check[i] == i;
+        double finalLength = tourLength(blocked, midMatrix, m);
+        // 局部最優：再跑一次純量迴圈不應找到改善
+        std::vector<int> again = blocked;
+        if (!valid || std::abs((initial - finalLength) - blockedGain) > 1e-6 * initial ||
+            scalarTwoOpt(again, midMatrix, m) > 1e-6) {
+            std::cerr << "[TEST FAILED] Blocked 2-Opt (n = " << m << ") is invalid or not 2-optimal." << std::endl;
+            return -1;
+        }
+
+        // 拋光已收斂的個體時，耗時主要在「確認沒有改善」的全掃描
+        auto t3 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < 20; ++r) LocalSearch::twoOptBlocked(again, midMatrix, m);
+        auto t4 = std::chrono::high_resolution_clock::now();
+        for (int r = 0; r < 20; ++r) scalarTwoOpt(again, midMatrix, m);
+        auto t5 = std::chrono::high_resolution_clock::now();
+
+        double blockedTime = std::chrono::duration<double>(t1 - t0).count();
+        double scalarTime = std::chrono::duration<double>(t2 - t1).count();
+        double blockedScan = std::chrono::duration<double>(t4 - t3).count();
+        double scalarScan = std::chrono::duration<double>(t5 - t4).count();
+        std::cout << "  n = " << std::setw(4) << m << " : from random " << std::setprecision(4) << blockedTime
+                  << " s vs " << scalarTime << " s, local-optimum scan " << blockedScan << " s vs " << scalarScan
+                  << " s (blocked vs scalar)" << std::endl;
+    }
+    std::cout << "  gain kernel: " << (LocalSearch::usesAvx2() ? "AVX2 gather (runtime dispatch)" : "scalar") << std::endl;
+    std::cout << "[Step 3] Blocked Full-Neighborhood 2-Opt: SUCCESS" << std::endl;
+
+    // 4. 區段平行 2-Opt (近鄰模式使用 Step 2 的實例；全鄰域模式使用較小實例)
+    std::vector<std::vector<int>> noNeighbors;
+    auto smallMatrix = Utils::precomputeDistanceMatrix(Utils::generateRandomCities(1500, 1000.0, 1000.0));
+    struct Case { const char* name; const std::vector<double>* matrix; int n; const std::vector<std::vector<int>>* neighbors; };
+    for (Case tc : {Case{"Neighbor Lists", &matrix, n, &neighbors}, Case{"Full Scan", &smallMatrix, 1500, &noNeighbors}}) {
+        std::vector<int> base = TourConstructor::nearestNeighbor(*tc.matrix, tc.n, 0.0);
+        double initial = tourLength(base, *tc.matrix, tc.n);
+
+        double serialLength = 0.0;
+        for (unsigned int threads : {1u, 4u}) {
+            std::vector<int> tour = base;
+            auto t0 = std::chrono::high_resolution_clock::now();
+            double parallelGain = LocalSearch::twoOptParallel(tour, *tc.matrix, tc.n, *tc.neighbors, threads);
+            double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+
+            std::vector<int> check = tour;
+            std::sort(check.begin(), check.end());
+            bool valid = true;
+            for (int i = 0; i < tc.n; ++i) valid = valid && check[i] == i;
+            double finalLength = tourLength(tour, *tc.matrix, tc.n);
+            if (threads == 1) serialLength = finalLength;
+            std::vector<int> again = tour;
+            bool converged = tc.neighbors->empty() ? LocalSearch::twoOptBlocked(again, *tc.matrix, tc.n) < 1e-6
+                                                   : finalLength <= 1.01 * serialLength;
+            if (!valid || std::abs((initial - finalLength) - parallelGain) > 1e-6 * initial || !converged) {
+                std::cerr << "[TEST FAILED] Parallel 2-Opt (" << tc.name << ", " << threads
+                          << " segments) is invalid or not 2-optimal." << std::endl;
+                return -1;
+            }
+            std::cout << "  " << std::left << std::setw(15) << tc.name << std::right << " x" << threads << " : "
+                      << std::setprecision(2) << initial << " -> " << finalLength << " ("
+                      << std::setprecision(4) << elapsed << " s)" << std::endl;
+        }
+    }
+    std::cout << "[Step 4] Segment-Parallel 2-Opt: SUCCESS" << std::endl;
+
+    std::cout << "All local search tests passed!" << std::endl;
+    return 0;
+}
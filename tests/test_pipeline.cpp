@@ -0,0 +1,87 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：管線化世代 ]
+ * 1. 正確性：平行與序列的管線化模式皆輸出合法路徑，且距離與矩陣計算結果一致 (含 rejectDuplicates)。
+ * 2. 效能比較：相同代數下比較管線化與原本世代模式的耗時與品質，數字僅供觀察，不作為通過條件。
+ */
+
+static bool isValidTour(const std::vector<int>& path, int n) {
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return static_cast<int>(path.size()) == n;
+}
+
+static double tourLength(const std::vector<int>& path, const std::vector<double>& matrix, int n) {
+    double len = 0.0;
+    for (int i = 0; i < n; ++i) len += matrix[static_cast<std::size_t>(path[i]) * n + path[(i + 1) % n]];
+    return len;
+}
+
+int main() {
+    std::cout << "--- Pipelined Generations Test ---" << std::endl;
+
+    const int n = 200;
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    auto matrix = Utils::precomputeDistanceMatrix(cities);
+
+    // 1. 正確性
+    for (bool parallel : {true, false}) {
+        GAConfig config = GAConfig::generateDefault(n);
+        config.populationSize = 300;
+        config.generations = 50;
+        config.pipelined = true;
+        config.useParallel = parallel;
+        config.rejectDuplicates = true;
+        config.localSearchCount = 4;
+        config.pipelineChunkSize = 32;
+
+        double lastReported = 1e18;
+        bool monotonic = true;
+        config.onGenerationComplete = [&](int, double best) {
+            if (best > lastReported) monotonic = false;
+            lastReported = best;
+        };
+
+        GASolver solver(config, cities);
+        Individual best = solver.solve();
+        if (!isValidTour(best.path, n) || !monotonic ||
+            std::abs(tourLength(best.path, matrix, n) - best.distance) > 1e-6 * best.distance) {
+            std::cerr << "[TEST FAILED] Pipelined solve (" << (parallel ? "parallel" : "serial")
+                      << ") returned an inconsistent tour." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 1] Tour Validity: SUCCESS" << std::endl;
+
+    // 2. 管線化 vs 世代模式
+    for (bool pipelined : {false, true}) {
+        GAConfig config = GAConfig::generateDefault(n);
+        config.populationSize = 1000;
+        config.generations = 300;
+        config.localSearchCount = 8;
+        config.pipelined = pipelined;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        GASolver solver(config, cities);
+        Individual best = solver.solve();
+        double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        std::cout << "  " << (pipelined ? "Pipelined   " : "Generational") << " : " << std::fixed
+                  << std::setprecision(2) << best.distance << " in " << elapsed << " s" << std::endl;
+    }
+    std::cout << "[Step 2] Throughput Comparison: SUCCESS" << std::endl;
+
+    std::cout << "All pipelined generation tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <atomic>
+#include <thread>
+#include <unistd.h>
+#include "Service/TourPublisher.h"
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：共享記憶體最佳路徑發佈 ]
+ * 1. 基本往返：發佈前讀不到路徑，發佈後版本遞增，複製讀取與零複製檢視皆與發佈內容一致。
+ * 2. 並行一致性：寫入端高速連續發佈 (每條路徑的所有元素與距離皆為同一個值)，
+ *    讀取端同時讀取，任何一次成功的讀取都不得混到兩次發佈的內容。
+ * 3. 求解器掛載：attach() 後求解，讀取端看到的路徑與最終結果一致，並輸出掛載前後的求解耗時 (數字僅供觀察)。
+ * 4. 錯誤處理：開啟不存在的區段、發佈超過容量的路徑皆拋出例外。
+ */
+
+static std::string segmentName(const char* tag) {
+    return std::string("ga_test_") + tag + "_" + std::to_string(getpid());
+}
+
+static Individual uniformTour(int value, int n) {
+    Individual ind;
+    ind.path.assign(n, value);
+    ind.distance = value;
+    return ind;
+}
+
+int main() {
+    std::cout << "--- Tour Publisher Test ---" << std::endl;
+
+    // 1. 基本往返
+    {
+        const int n = 100;
+        TourPublisher publisher(segmentName("roundtrip"), n);
+        TourReader reader(publisher.name());
+        TourSnapshot snapshot;
+        if (reader.version() != 0 || reader.read(snapshot)) {
+            std::cerr << "[TEST FAILED] Reader saw a tour before anything was published." << std::endl;
+            return -1;
+        }
+
+        Individual tour;
+        for (int i = 0; i < n; ++i) tour.path.push_back(n - 1 - i);
+        tour.distance = 1234.5;
+        publisher.publish(7, tour);
+        tour.distance = 1000.25;
+        std::reverse(tour.path.begin(), tour.path.end());
+        publisher.publish(9, tour, true);
+
+        TourView view;
+        if (reader.version() != 2 || !reader.read(snapshot) || !reader.acquire(view)) {
+            std::cerr << "[TEST FAILED] Published tour could not be read." << std::endl;
+            return -1;
+        }
+        std::vector<int> viewed(view.path, view.path + view.count);
+        if (snapshot.generation != 9 || snapshot.distance != tour.distance || !snapshot.final ||
+            snapshot.path != tour.path || viewed != tour.path || !reader.validate(view)) {
+            std::cerr << "[TEST FAILED] Read back tour does not match the published one." << std::endl;
+            return -1;
+        }
+        // 零複製檢視所在的緩衝區被覆寫後必須驗證失敗 (雙緩衝：再發佈兩次才會輪回同一個緩衝區)
+        publisher.publish(10, tour);
+        publisher.publish(11, tour);
+        if (reader.validate(view)) {
+            std::cerr << "[TEST FAILED] Stale zero-copy view still validated." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 1] Publish & Read Round Trip: SUCCESS" << std::endl;
+
+    // 2. 並行一致性
+    {
+        const int n = 4096;
+        TourPublisher publisher(segmentName("torture"), n);
+        TourReader reader(publisher.name());
+        std::atomic<bool> writing{true};
+        long long published = 0;
+
+        std::thread writer([&]() {
+            Individual tour = uniformTour(0, n);
+            auto start = std::chrono::steady_clock::now();
+            while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(300)) {
+                ++published;
+                std::fill(tour.path.begin(), tour.path.end(), static_cast<int>(published));
+                tour.distance = static_cast<double>(published);
+                publisher.publish(published, tour);
+            }
+            writing = false;
+        });
+
+        long long reads = 0, torn = 0, lastSeen = 0;
+        bool monotonic = true;
+        TourSnapshot snapshot;
+        while (writing) {
+            if (!reader.read(snapshot)) continue;
+            ++reads;
+            int value = static_cast<int>(snapshot.generation);
+            bool uniform = snapshot.distance == value && static_cast<int>(snapshot.path.size()) == n &&
+                           std::all_of(snapshot.path.begin(), snapshot.path.end(), [value](int v) { return v == value; });
+            if (!uniform) ++torn;
+            if (snapshot.generation < lastSeen) monotonic = false;
+            lastSeen = snapshot.generation;
+        }
+        writer.join();
+
+        if (torn != 0 || !monotonic || reads == 0 || !reader.read(snapshot) || snapshot.generation != published) {
+            std::cerr << "[TEST FAILED] " << torn << " torn reads out of " << reads << " (monotonic: " << monotonic
+                      << ")" << std::endl;
+            return -1;
+        }
+        std::cout << "  n = " << n << " : " << published << " publishes, " << reads << " consistent reads" << std::endl;
+    }
+    std::cout << "[Step 2] Concurrent Consistency: SUCCESS" << std::endl;
+
+    // 3. 求解器掛載
+    {
+        const int n = 300;
+        auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+        GAConfig config = GAConfig::generateDefault(n);
+        config.populationSize = 200;
+        config.generations = 100;
+
+        Utils::seed(5);
+        auto start = std::chrono::high_resolution_clock::now();
+        GASolver plain(config, cities);
+        Individual plainBest = plain.solve();
+        double plainTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        TourPublisher publisher(segmentName("solver"), n);
+        int callbacks = 0;
+        config.onBestImproved = [&callbacks](int, const Individual&) { ++callbacks; };
+        publisher.attach(config);
+
+        Utils::seed(5);
+        start = std::chrono::high_resolution_clock::now();
+        GASolver published(config, cities);
+        Individual best = published.solve();
+        double publishTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        TourReader reader(publisher.name());
+        TourSnapshot snapshot;
+        if (!reader.read(snapshot) || snapshot.path != best.path || snapshot.distance != best.distance ||
+            callbacks == 0 || reader.version() != static_cast<std::uint64_t>(callbacks)) {
+            std::cerr << "[TEST FAILED] Published tour differs from the solver result." << std::endl;
+            return -1;
+        }
+        std::cout << "  Without publisher : " << std::fixed << std::setprecision(2) << plainBest.distance << " ("
+                  << std::setprecision(3) << plainTime << " s)" << std::endl;
+        std::cout << "  With publisher    : " << std::setprecision(2) << best.distance << " (" << std::setprecision(3)
+                  << publishTime << " s, " << callbacks << " publishes)" << std::endl;
+    }
+    std::cout << "[Step 3] Solver Attachment: SUCCESS" << std::endl;
+
+    // 4. 錯誤處理
+    {
+        bool missingThrown = false;
+        try {
+            TourReader reader(segmentName("missing"));
+        } catch (const std::runtime_error&) {
+            missingThrown = true;
+        }
+        bool capacityThrown = false;
+        TourPublisher publisher(segmentName("capacity"), 10);
+        try {
+            publisher.publish(0, uniformTour(1, 11));
+        } catch (const std::runtime_error&) {
+            capacityThrown = true;
+        }
+        if (!missingThrown || !capacityThrown) {
+            std::cerr << "[TEST FAILED] Invalid usage did not throw." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 4] Error Handling: SUCCESS" << std::endl;
+
+    std::cout << "All tour publisher tests passed!" << std::endl;
+    return 0;
+}
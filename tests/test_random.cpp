@@ -0,0 +1,163 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <climits>
+#include <future>
+#include <random>
+#include "Core/RandomStream.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：批次亂數串流 ]
+ * 1. 區間正確性：getRandomInt 涵蓋且只落在 [min, max] (含負數、單點與整個 int 範圍)，getRandomDouble 落在 [min, max)。
+ * 2. 均勻性：非 2 的冪次區間 (Lemire 需要拒絕取樣的情況) 與浮點數分桶的卡方統計量在合理範圍內，
+ *    Utils::shuffle 對每個位置的分佈也一致。
+ * 3. 可重現性：相同種子產生相同序列，不同執行緒的預設序列互不相同。
+ * 4. 吞吐量：比較 std::uniform_int_distribution + mt19937 與批次串流的抽取速度 (數字僅供觀察，並標示是否為最佳化建置)。
+ */
+
+// 卡方統計量 (期望值相同的分桶)
+static double chiSquare(const std::vector<long long>& counts, double expected) {
+    double chi = 0.0;
+    for (long long c : counts) chi += (c - expected) * (c - expected) / expected;
+    return chi;
+}
+
+int main() {
+    std::cout << "--- Random Stream Test ---" << std::endl;
+
+    // 1. 區間正確性
+    {
+        struct Range { int min, max; };
+        for (Range r : {Range{0, 9}, Range{-5, 5}, Range{7, 7}, Range{0, 1}, Range{-1000, 999}}) {
+            int lo = INT_MAX, hi = INT_MIN;
+            for (int i = 0; i < 200000; ++i) {
+                int v = Utils::getRandomInt(r.min, r.max);
+                lo = std::min(lo, v);
+                hi = std::max(hi, v);
+            }
+            if (lo != r.min || hi != r.max) {
+                std::cerr << "[TEST FAILED] getRandomInt(" << r.min << ", " << r.max << ") produced [" << lo << ", "
+                          << hi << "]" << std::endl;
+                return -1;
+            }
+        }
+        bool negative = false, positive = false;
+        for (int i = 0; i < 1000; ++i) {
+            int v = Utils::getRandomInt(INT_MIN, INT_MAX);
+            negative |= v < 0;
+            positive |= v > 0;
+        }
+        double lo = 1e300, hi = -1e300;
+        for (int i = 0; i < 200000; ++i) {
+            double v = Utils::getRandomDouble(-2.0, 3.0);
+            lo = std::min(lo, v);
+            hi = std::max(hi, v);
+        }
+        if (!negative || !positive || lo < -2.0 || hi >= 3.0 || lo > -1.99 || hi < 2.99) {
+            std::cerr << "[TEST FAILED] Full-range ints or doubles are out of bounds." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 1] Range Correctness: SUCCESS" << std::endl;
+
+    // 2. 均勻性 (自由度 k - 1 的卡方在 k ≈ 100 時，臨界值 (p = 0.001) 約為 149；容許一些餘裕)
+    {
+        const int buckets = 100;
+        const long long draws = 2000000;
+        std::vector<long long> ints(buckets, 0), doubles(buckets, 0);
+        for (long long i = 0; i < draws; ++i) {
+            ++ints[Utils::getRandomInt(0, buckets - 1)];
+            ++doubles[static_cast<int>(Utils::getRandomDouble() * buckets)];
+        }
+        double expected = static_cast<double>(draws) / buckets;
+        double chiInts = chiSquare(ints, expected);
+        double chiDoubles = chiSquare(doubles, expected);
+
+        // 大區間 (range 接近 2^32 的 2/3) 下無偏差：若以取餘數映射，前半段的機率會是後半段的兩倍
+        const std::uint32_t range = 3000000000u;
+        RandomStream stream(42);
+        long long lowerHalf = 0;
+        for (long long i = 0; i < draws; ++i) lowerHalf += stream.bounded(range) < range / 2;
+        double lowerShare = static_cast<double>(lowerHalf) / draws;
+
+        // Fisher-Yates：每個元素出現在每個位置的次數相同
+        const int m = 8;
+        std::vector<long long> positions(m * m, 0);
+        std::vector<int> items(m);
+        for (int t = 0; t < 200000; ++t) {
+            for (int i = 0; i < m; ++i) items[i] = i;
+            Utils::shuffle(items.begin(), items.end());
+            for (int i = 0; i < m; ++i) ++positions[items[i] * m + i];
+        }
+        double chiShuffle = chiSquare(positions, 200000.0 / m);
+
+        std::cout << "  chi^2 ints = " << std::fixed << std::setprecision(1) << chiInts << ", doubles = " << chiDoubles
+                  << ", shuffle = " << chiShuffle << ", lower-half share = " << std::setprecision(4) << lowerShare
+                  << std::endl;
+        if (chiInts > 180.0 || chiDoubles > 180.0 || chiShuffle > 130.0 || std::abs(lowerShare - 0.5) > 0.005) {
+            std::cerr << "[TEST FAILED] Draws are not uniform." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 2] Uniformity: SUCCESS" << std::endl;
+
+    // 3. 可重現性
+    {
+        auto sample = []() {
+            std::vector<double> values;
+            for (int i = 0; i < 1000; ++i) {
+                values.push_back(Utils::getRandomInt(0, 1000000));
+                values.push_back(Utils::getRandomDouble());
+            }
+            return values;
+        };
+        Utils::seed(123);
+        auto a = sample();
+        Utils::seed(123);
+        auto b = sample();
+        Utils::seed(124);
+        auto c = sample();
+        auto t1 = std::async(std::launch::async, sample);
+        auto t2 = std::async(std::launch::async, sample);
+        if (a != b || a == c || t1.get() == t2.get()) {
+            std::cerr << "[TEST FAILED] Seeding is not reproducible or threads share a sequence." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 3] Reproducibility & Thread Independence: SUCCESS" << std::endl;
+
+    // 4. 吞吐量
+    {
+        const int draws = 20000000;
+        std::mt19937 gen(1);
+        long long sink = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < draws; ++i) {
+            std::uniform_int_distribution<int> dist(0, 999);
+            sink += dist(gen);
+        }
+        double baseline = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < draws; ++i) sink += Utils::getRandomInt(0, 999);
+        double buffered = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+#ifdef __OPTIMIZE__
+        std::cout << "  (optimized build)" << std::endl;
+#else
+        std::cout << "  (unoptimized build: throughput is not representative)" << std::endl;
+#endif
+        std::cout << "  mt19937 + distribution : " << std::setprecision(2) << draws / baseline / 1e6 << " M draws/s"
+                  << std::endl;
+        std::cout << "  Buffered stream        : " << draws / buffered / 1e6 << " M draws/s (checksum " << sink % 10
+                  << ")" << std::endl;
+    }
+    std::cout << "[Step 4] Throughput: SUCCESS" << std::endl;
+
+    std::cout << "All random stream tests passed!" << std::endl;
+    return 0;
+}
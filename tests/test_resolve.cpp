@@ -0,0 +1,233 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：增量重新求解 (Warm Start) ]
+ * 1. 正確性：新增 / 移除 / 移動城市後，城市列表依規則重新編號，輸出路徑合法且距離與新座標一致
+ *    (涵蓋一般模式、近鄰清單模式與 Hilbert 重新編號模式)。
+ * 2. 只有移動的變更：求解器獨佔實例時就地更新距離矩陣 (不配置新矩陣)，
+ *    實例與其他持有者共享時則另建新矩陣，共享的舊實例保持不變。
+ * 3. 暖啟動：重新求解的結果不得劣於依相同規則修補後的舊最佳路徑 (與隨機抽樣無關)，
+ *    並輸出相同代數下從頭求解的品質與兩者耗時 (僅供觀察；以固定種子序列執行，結果可重現)。
+ */
+
+static double tourLength(const std::vector<int>& path, const std::vector<City>& cities) {
+    auto matrix = Utils::precomputeDistanceMatrix(cities);
+    int n = static_cast<int>(cities.size());
+    double len = 0.0;
+    for (int i = 0; i < n; ++i) len += matrix[static_cast<std::size_t>(path[i]) * n + path[(i + 1) % n]];
+    return len;
+}
+
+static bool isValidTour(const std::vector<int>& path, int n) {
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return static_cast<int>(path.size()) == n;
+}
+
+// 依 InstanceDelta 的編號規則，獨立建立預期的新城市列表
+static std::vector<City> applyExpected(const std::vector<City>& cities, const InstanceDelta& delta) {
+    std::vector<City> moved = cities;
+    for (const City& c : delta.moved) {
+        moved[c.id].x = c.x;
+        moved[c.id].y = c.y;
+    }
+    std::vector<City> result;
+    for (int i = 0; i < static_cast<int>(cities.size()); ++i) {
+        if (std::find(delta.removed.begin(), delta.removed.end(), i) == delta.removed.end()) {
+            result.push_back(moved[i]);
+        }
+    }
+    for (const City& c : delta.added) result.push_back(c);
+    for (int i = 0; i < static_cast<int>(result.size()); ++i) result[i].id = i;
+    return result;
+}
+
+// 依 resolve 的修補規則獨立修補舊路徑：刪除移除與移動的城市並重新編號，
+// 再依序 (移動者依舊索引，其後為新增者) 以最便宜插入放回，回傳修補後的長度
+static double repairedLength(const std::vector<int>& path, const InstanceDelta& delta, const std::vector<City>& cities) {
+    int oldN = static_cast<int>(path.size());
+    std::vector<char> removed(oldN, 0), moved(oldN, 0);
+    for (int r : delta.removed) removed[r] = 1;
+    for (const City& c : delta.moved) moved[c.id] = 1;
+    std::vector<int> newIndex(oldN, -1), reinsert;
+    for (int i = 0, next = 0; i < oldN; ++i) {
+        if (removed[i]) continue;
+        newIndex[i] = next++;
+        if (moved[i]) reinsert.push_back(newIndex[i]);
+    }
+    int n = static_cast<int>(cities.size());
+    for (int c = n - static_cast<int>(delta.added.size()); c < n; ++c) reinsert.push_back(c);
+
+    auto matrix = Utils::precomputeDistanceMatrix(cities);
+    auto d = [&matrix, n](int a, int b) { return matrix[static_cast<std::size_t>(a) * n + b]; };
+    std::vector<int> tour;
+    for (int c : path) {
+        if (newIndex[c] >= 0 && !moved[c]) tour.push_back(newIndex[c]);
+    }
+    for (int c : reinsert) {
+        int m = static_cast<int>(tour.size());
+        int bestPos = 0;
+        double bestCost = std::numeric_limits<double>::max();
+        for (int i = 0; i < m; ++i) {
+            int a = tour[i], b = tour[(i + 1) % m];
+            double cost = d(a, c) + d(c, b) - d(a, b);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestPos = i + 1;
+            }
+        }
+        tour.insert(tour.begin() + bestPos, c);
+    }
+    return tourLength(tour, cities);
+}
+
+static InstanceDelta randomDelta(int n, int changes) {
+    InstanceDelta delta;
+    delta.added = Utils::generateRandomCities(changes, 1000.0, 1000.0);
+    std::vector<int> ids(n);
+    for (int i = 0; i < n; ++i) ids[i] = i;
+    std::shuffle(ids.begin(), ids.end(), Utils::getGenerator());
+    delta.removed.assign(ids.begin(), ids.begin() + changes);
+    for (int i = changes; i < 2 * changes; ++i) {
+        delta.moved.push_back({ids[i], Utils::getRandomDouble(0, 1000.0), Utils::getRandomDouble(0, 1000.0)});
+    }
+    return delta;
+}
+
+int main() {
+    std::cout << "--- Incremental Re-Solve Test ---" << std::endl;
+
+    // 1. 正確性
+    struct Scenario { const char* name; int n; bool renumber; int neighborThreshold; };
+    for (Scenario sc : {Scenario{"Dense Matrix", 300, false, 1000},
+                        Scenario{"Neighbor Lists", 1200, false, 1000},
+                        Scenario{"Hilbert Renumbered", 300, true, 1000}}) {
+        auto cities = Utils::generateRandomCities(sc.n, 1000.0, 1000.0);
+        GAConfig config = GAConfig::generateDefault(sc.n);
+        config.populationSize = std::min(config.populationSize, 400);
+        config.generations = 30;
+        config.renumberCities = sc.renumber;
+        config.neighborListThreshold = sc.neighborThreshold;
+
+        GASolver solver(config, cities);
+        solver.solve();
+
+        for (int round = 0; round < 3; ++round) {
+            InstanceDelta delta = randomDelta(static_cast<int>(cities.size()), 5);
+            cities = applyExpected(cities, delta);
+            Individual best = solver.resolve(delta, 10);
+
+            std::vector<City> actual = solver.getCities();
+            bool sameCities = actual.size() == cities.size();
+            for (std::size_t i = 0; sameCities && i < cities.size(); ++i) {
+                sameCities = actual[i].id == cities[i].id && actual[i].x == cities[i].x && actual[i].y == cities[i].y;
+            }
+            int n = static_cast<int>(cities.size());
+            if (!sameCities || !isValidTour(best.path, n) ||
+                std::abs(tourLength(best.path, cities) - best.distance) > 1e-6 * best.distance) {
+                std::cerr << "[TEST FAILED] " << sc.name << ": inconsistent state after round " << round << std::endl;
+                return -1;
+            }
+        }
+        std::cout << "  " << std::left << std::setw(20) << sc.name << ": OK" << std::endl;
+    }
+    std::cout << "[Step 1] Delta Application & Repair: SUCCESS" << std::endl;
+
+    // 2. 只有移動的變更：獨佔時就地更新，共享時不影響其他持有者
+    {
+        const int m = 300;
+        auto cities = Utils::generateRandomCities(m, 1000.0, 1000.0);
+        GAConfig config = GAConfig::generateDefault(m);
+        config.populationSize = 100;
+        config.generations = 5;
+        GASolver solver(config, cities);
+        solver.solve();
+
+        auto movesOnly = [m]() {
+            InstanceDelta delta;
+            for (int i = 0; i < 5; ++i) {
+                delta.moved.push_back({i * 7, Utils::getRandomDouble(0, 1000.0), Utils::getRandomDouble(0, 1000.0)});
+            }
+            return delta;
+        };
+        auto matches = [](const ProblemInstance& instance, const std::vector<City>& expected) {
+            auto matrix = Utils::precomputeDistanceMatrix(expected);
+            return instance.distances().size() == matrix.size() &&
+                   std::equal(matrix.begin(), matrix.end(), instance.distances().begin());
+        };
+
+        // 獨佔：矩陣沿用同一塊記憶體 (getInstance() 的暫時參照在運算式結束時釋放)
+        const double* before = solver.getInstance()->distances().data();
+        InstanceDelta delta = movesOnly();
+        cities = applyExpected(cities, delta);
+        solver.resolve(delta, 2);
+        bool inPlace = solver.getInstance()->distances().data() == before && matches(*solver.getInstance(), cities);
+
+        // 共享：另建新矩陣，舊實例內容不變
+        std::shared_ptr<const ProblemInstance> shared = solver.getInstance();
+        std::vector<City> sharedCities = cities;
+        delta = movesOnly();
+        cities = applyExpected(cities, delta);
+        solver.resolve(delta, 2);
+        bool copied = solver.getInstance() != shared && matches(*shared, sharedCities) &&
+                      matches(*solver.getInstance(), cities);
+        if (!inPlace || !copied) {
+            std::cerr << "[TEST FAILED] Moves-only update: in-place " << inPlace << ", shared copy " << copied
+                      << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 2] Moves-Only Matrix Update: SUCCESS" << std::endl;
+
+    // 3. 暖啟動：修補後的舊族群保有舊解的結構，結果不得劣於修補後的舊最佳路徑；
+    //    相同代數的從頭求解只作為品質與耗時的對照 (預設參數的 GA 在此規模常停在初始的 2-Opt 局部最優，
+    //    兩者的優劣取決於抽樣，不作為判定條件)
+    // 序列執行並固定種子：求解只使用主執行緒的亂數引擎，每次執行的結果相同
+    const int n = 500;
+    Utils::seed(37);
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    GAConfig config = GAConfig::generateDefault(n);
+    config.populationSize = 400;
+    config.generations = 300;
+    config.useParallel = false;
+    GASolver warm(config, cities);
+    Individual previous = warm.solve();
+
+    InstanceDelta delta = randomDelta(n, 5);
+    cities = applyExpected(cities, delta);
+    double repaired = repairedLength(previous.path, delta, cities);
+    const int resumeGenerations = 20;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    Individual warmBest = warm.resolve(delta, resumeGenerations);
+    double warmTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    config.generations = resumeGenerations;
+    GASolver cold(config, cities);
+    Individual coldBest = cold.solve();
+    double coldTime = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << "  Repaired Best : " << std::fixed << std::setprecision(2) << repaired << std::endl;
+    std::cout << "  Warm Re-Solve : " << warmBest.distance << " (" << warmTime << " s)" << std::endl;
+    std::cout << "  Cold Solve    : " << coldBest.distance << " (" << coldTime << " s)" << std::endl;
+    if (warmBest.distance > repaired * (1.0 + 1e-9)) {
+        std::cerr << "[TEST FAILED] Warm start lost the repaired previous best." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 3] Warm Start Quality: SUCCESS" << std::endl;
+
+    std::cout << "All incremental re-solve tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,236 @@
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <functional>
+#include <limits>
+#include <thread>
+#include "Core/GASolver.h"
+#include "Core/DecompositionSolver.h"
+#include "Core/Utils.h"
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+/**
+ * [ 擴展性基準測試 (Scaling Benchmark) ]
+ * 以均勻、群聚、格點三種合成分佈，掃描 n = 1k ~ 100k 與執行緒數 1 ~ 全部核心，
+ * 記錄牆鐘時間、峰值 RSS、每秒評估次數與強 / 弱擴展效率，輸出為 CSV，用來找出目前架構的瓶頸規模。
+ *
+ * - GASolver：距離矩陣需要 $8n^2$ bytes，超過實體記憶體一半時該列標記為 skipped_memory。
+ *   n > 46340 時 int 型別的矩陣索引會溢位，該列標記為 skipped_int_index。
+ *   強擴展固定族群規模；弱擴展讓族群規模與執行緒數等比成長。
+ * - DecompositionSolver：不需 $n \times n$ 矩陣，作為大規模的對照組 (僅量測強擴展)。
+ * - evals/s：GASolver 以第二代至最後一代的穩態區間計算；DecompositionSolver 以子問題 GA 的總評估數除以求解時間。
+ * - 峰值 RSS：Linux 上每次量測前寫入 /proc/self/clear_refs 重設高水位 (VmHWM)；
+ *   無法重設時退回 getrusage，數值為「程序啟動至今」的峰值。
+ *
+ * 用法：test_scaling_benchmark [輸出.csv] [最大 n] [代數]
+ *       預設為建置目錄下的 scaling.csv、100000、10。
+ */
+
+struct Measurement {
+    std::string status = "ok";
+    double setupSeconds = 0.0;
+    double solveSeconds = 0.0;
+    double evolveSeconds = 0.0; // 計算 evals/s 的時間區間
+    double peakRssMb = 0.0;
+    long long evaluations = 0;
+    double best = 0.0;
+};
+
+// 嘗試重設峰值 RSS，成功時回傳 true
+static bool resetPeakRss() {
+#ifdef __linux__
+    std::ofstream clear("/proc/self/clear_refs");
+    if (!clear) return false;
+    clear << "5";
+    return static_cast<bool>(clear.flush());
+#else
+    return false;
+#endif
+}
+
+static double peakRssMb() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) return std::stod(line.substr(6)) / 1024.0;
+    }
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0; // Linux 以 KB 為單位
+#else
+    return 0.0;
+#endif
+}
+
+static double physicalMemoryBytes() {
+#ifdef __linux__
+    return static_cast<double>(sysconf(_SC_PHYS_PAGES)) * static_cast<double>(sysconf(_SC_PAGE_SIZE));
+#else
+    return 8.0 * 1024 * 1024 * 1024;
+#endif
+}
+
+static std::vector<City> makeInstance(const std::string& distribution, int n) {
+    if (distribution == "clustered") return Utils::generateClusteredCities(n, std::max(4, n / 500), 1e6, 1e6);
+    if (distribution == "grid") return Utils::generateGridCities(n, 1e6, 1e6, 0.1);
+    return Utils::generateRandomCities(n, 1e6, 1e6);
+}
+
+static Measurement runGA(const std::vector<City>& cities, unsigned int threads, int population, int generations) {
+    Measurement m;
+    int n = static_cast<int>(cities.size());
+    if (8.0 * n * n > 0.5 * physicalMemoryBytes()) {
+        m.status = "skipped_memory";
+        return m;
+    }
+    if (static_cast<long long>(n) * n > std::numeric_limits<int>::max()) {
+        m.status = "skipped_int_index"; // 矩陣索引 i * n + j 以 int 計算，n > 46340 會溢位
+        return m;
+    }
+
+    GAConfig config = GAConfig::generateDefault(n);
+    config.populationSize = population;
+    config.generations = generations;
+    config.threadCount = threads;
+    config.useParallel = threads > 1;
+    // 以第一代與最後一代回呼之間的時間計算穩態吞吐量，排除初始族群建構 (近鄰 / 貪婪邊為 O(n^2))
+    long long generationsDone = 0;
+    std::chrono::high_resolution_clock::time_point firstGen, lastGen;
+    config.onGenerationComplete = [&](int, double) {
+        lastGen = std::chrono::high_resolution_clock::now();
+        if (generationsDone++ == 0) firstGen = lastGen;
+    };
+
+    resetPeakRss();
+    auto start = std::chrono::high_resolution_clock::now();
+    GASolver solver(config, cities);
+    auto built = std::chrono::high_resolution_clock::now();
+    Individual best = solver.solve();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    m.setupSeconds = std::chrono::duration<double>(built - start).count();
+    m.solveSeconds = std::chrono::duration<double>(end - built).count();
+    m.peakRssMb = peakRssMb();
+    m.evaluations = static_cast<long long>(population) * std::max(0LL, generationsDone - 1);
+    m.evolveSeconds = std::chrono::duration<double>(lastGen - firstGen).count();
+    m.best = best.distance;
+    return m;
+}
+
+static Measurement runDecomposition(const std::vector<City>& cities, unsigned int threads, int generations) {
+    Measurement m;
+    std::atomic<long long> evaluations{0};
+
+    DecompositionConfig config;
+    config.workerCount = threads;
+    config.clusterConfig = [generations, &evaluations](int n) {
+        GAConfig sub = DecompositionConfig::clusterDefault(n);
+        sub.generations = std::min(sub.generations, 10 * generations);
+        sub.useParallel = false;
+        int population = sub.populationSize;
+        sub.onGenerationComplete = [population, &evaluations](int, double) { evaluations += population; };
+        return sub;
+    };
+
+    resetPeakRss();
+    auto start = std::chrono::high_resolution_clock::now();
+    DecompositionSolver solver(config, cities);
+    auto built = std::chrono::high_resolution_clock::now();
+    Individual best = solver.solve();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    m.setupSeconds = std::chrono::duration<double>(built - start).count();
+    m.solveSeconds = std::chrono::duration<double>(end - built).count();
+    m.peakRssMb = peakRssMb();
+    m.evaluations = evaluations.load();
+    m.evolveSeconds = m.solveSeconds;
+    m.best = best.distance;
+    return m;
+}
+
+int main(int argc, char** argv) {
+    std::string outputPath = argc > 1 ? argv[1] : std::string(SCALING_OUTPUT_DIR) + "scaling.csv";
+    int maxN = argc > 2 ? std::stoi(argv[2]) : 100000;
+    int generations = argc > 3 ? std::stoi(argv[3]) : 10;
+    const int basePopulation = 256;
+
+    unsigned int hw = std::thread::hardware_concurrency();
+    if (hw == 0) hw = 2; // 保底機制
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int t = 1; t < hw; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(hw);
+
+    std::ofstream csv(outputPath);
+    if (!csv) {
+        std::cerr << "Cannot open " << outputPath << std::endl;
+        return -1;
+    }
+    csv << "distribution,solver,n,threads,scaling,population,generations,status,"
+           "setup_s,solve_s,wall_s,peak_rss_mb,evals_per_s,efficiency,best_distance\n";
+
+    std::cout << "===============================================" << std::endl;
+    std::cout << "        Scaling Benchmark (up to n = " << maxN << ")" << std::endl;
+    std::cout << "===============================================" << std::endl;
+    std::cout << "  Peak RSS reset: " << (resetPeakRss() ? "per run (clear_refs)" : "process lifetime") << std::endl;
+
+    for (const std::string distribution : {"uniform", "clustered", "grid"}) {
+        for (int n : {1000, 2000, 5000, 10000, 20000, 50000, 100000}) {
+            if (n > maxN) break;
+            auto cities = makeInstance(distribution, n);
+
+            struct Run { const char* solver; const char* scaling; };
+            for (Run run : {Run{"ga", "strong"}, Run{"ga", "weak"}, Run{"decomposition", "strong"}}) {
+                bool isGA = std::string(run.solver) == "ga";
+                bool weak = std::string(run.scaling) == "weak";
+                double baseline = 0.0;
+
+                for (unsigned int t : threadCounts) {
+                    int population = weak ? basePopulation * static_cast<int>(t) : basePopulation;
+                    Measurement m = isGA ? runGA(cities, t, population, generations)
+                                         : runDecomposition(cities, t, generations);
+
+                    // 強擴展：T1 / (t * Tt)；弱擴展 (工作量隨 t 成長)：T1 / Tt
+                    double efficiency = 0.0;
+                    if (m.status == "ok") {
+                        if (t == 1) baseline = m.solveSeconds;
+                        if (baseline > 0.0 && m.solveSeconds > 0.0) {
+                            efficiency = weak ? baseline / m.solveSeconds : baseline / (t * m.solveSeconds);
+                        }
+                    }
+                    double evalsPerSecond = m.evolveSeconds > 0.0 ? m.evaluations / m.evolveSeconds : 0.0;
+
+                    csv << distribution << ',' << run.solver << ',' << n << ',' << t << ',' << run.scaling << ','
+                        << (isGA ? population : 0) << ',' << generations << ',' << m.status << ','
+                        << std::fixed << std::setprecision(4) << m.setupSeconds << ',' << m.solveSeconds << ','
+                        << m.setupSeconds + m.solveSeconds << ',' << std::setprecision(1) << m.peakRssMb << ','
+                        << std::setprecision(0) << evalsPerSecond << ',' << std::setprecision(3) << efficiency << ','
+                        << std::setprecision(2) << m.best << '\n';
+                    csv.flush();
+
+                    std::cout << "  " << std::left << std::setw(10) << distribution << std::setw(14) << run.solver
+                              << std::setw(7) << run.scaling << "n = " << std::setw(7) << n << "t = " << std::setw(3)
+                              << t << std::right;
+                    if (m.status != "ok") {
+                        std::cout << " : " << m.status << std::endl;
+                        continue;
+                    }
+                    std::cout << " : " << std::fixed << std::setprecision(2) << m.setupSeconds + m.solveSeconds
+                              << " s, " << std::setprecision(0) << m.peakRssMb << " MB, " << evalsPerSecond
+                              << " evals/s, eff " << std::setprecision(2) << efficiency << std::endl;
+                }
+            }
+        }
+    }
+
+    std::cout << "Results written to " << outputPath << std::endl;
+    return 0;
+}
@@ -0,0 +1,125 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include "Core/GASolver.h"
+#include "Core/Utils.h"
+
+/**
+ * [ 測試目的：免排序的排名與親代選擇 ]
+ * 1. 正確性：三種選擇模式 × 世代 / 管線化，皆輸出合法路徑，且 getBestIndividual() (索引 0) 即為最佳解。
+ * 2. 平行精英選取：族群超過平行門檻時，各執行緒分段取前 k 名再合併，結果仍須一致。
+ * 3. 效能比較：相同代數下比較三種模式的耗時與品質，數字僅供觀察，不作為通過條件。
+ */
+
+static bool isValidTour(const std::vector<int>& path, int n) {
+    std::vector<int> sorted = path;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < n; ++i) {
+        if (sorted[i] != i) return false;
+    }
+    return static_cast<int>(path.size()) == n;
+}
+
+static double tourLength(const std::vector<int>& path, const std::vector<double>& matrix, int n) {
+    double len = 0.0;
+    for (int i = 0; i < n; ++i) len += matrix[static_cast<std::size_t>(path[i]) * n + path[(i + 1) % n]];
+    return len;
+}
+
+static const char* modeName(SelectionMode mode) {
+    switch (mode) {
+    case SelectionMode::Rank: return "Rank";
+    case SelectionMode::StochasticUniversal: return "SUS";
+    default: return "Tournament";
+    }
+}
+
+// 求解並檢查回傳路徑、回報距離與索引 0 的約定
+static bool solveAndCheck(const GAConfig& config, const std::vector<City>& cities, const std::vector<double>& matrix,
+                          double& distance) {
+    int n = static_cast<int>(cities.size());
+    GASolver solver(config, cities);
+    Individual best = solver.solve();
+    Individual front = solver.getBestIndividual();
+    distance = best.distance;
+    return isValidTour(best.path, n) && isValidTour(front.path, n) &&
+           std::abs(tourLength(best.path, matrix, n) - best.distance) <= 1e-6 * best.distance &&
+           std::abs(front.distance - best.distance) <= 1e-6 * best.distance;
+}
+
+int main() {
+    std::cout << "--- Selection Modes Test ---" << std::endl;
+
+    const SelectionMode modes[] = {SelectionMode::Tournament, SelectionMode::Rank, SelectionMode::StochasticUniversal};
+    const int n = 200;
+    auto cities = Utils::generateRandomCities(n, 1000.0, 1000.0);
+    auto matrix = Utils::precomputeDistanceMatrix(cities);
+
+    // 1. 正確性
+    for (SelectionMode mode : modes) {
+        for (bool pipelined : {false, true}) {
+            GAConfig config = GAConfig::generateDefault(n);
+            config.populationSize = 300;
+            config.generations = 40;
+            config.selectionMode = mode;
+            config.pipelined = pipelined;
+            config.rejectDuplicates = true;
+            config.localSearchCount = 4;
+
+            double distance = 0.0;
+            if (!solveAndCheck(config, cities, matrix, distance)) {
+                std::cerr << "[TEST FAILED] " << modeName(mode) << (pipelined ? " (pipelined)" : " (generational)")
+                          << " returned an inconsistent best individual." << std::endl;
+                return -1;
+            }
+        }
+    }
+    std::cout << "[Step 1] Tour Validity & Best-at-Front: SUCCESS" << std::endl;
+
+    // 2. 大族群：觸發分段平行的精英選取
+    const int smallN = 40;
+    auto smallCities = Utils::generateRandomCities(smallN, 1000.0, 1000.0);
+    auto smallMatrix = Utils::precomputeDistanceMatrix(smallCities);
+    for (SelectionMode mode : modes) {
+        GAConfig config = GAConfig::generateDefault(smallN);
+        config.populationSize = 20000;
+        config.generations = 3;
+        config.selectionMode = mode;
+        config.useParallel = true;
+        config.threadCount = 4;
+
+        double distance = 0.0;
+        if (!solveAndCheck(config, smallCities, smallMatrix, distance)) {
+            std::cerr << "[TEST FAILED] Parallel elite selection (" << modeName(mode) << ") was inconsistent." << std::endl;
+            return -1;
+        }
+    }
+    std::cout << "[Step 2] Parallel Elite Selection: SUCCESS" << std::endl;
+
+    // 3. 模式比較
+    for (SelectionMode mode : modes) {
+        GAConfig config = GAConfig::generateDefault(n);
+        config.populationSize = 1000;
+        config.generations = 200;
+        config.localSearchCount = 8;
+        config.selectionMode = mode;
+
+        double distance = 0.0;
+        auto start = std::chrono::high_resolution_clock::now();
+        bool ok = solveAndCheck(config, cities, matrix, distance);
+        double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        if (!ok) {
+            std::cerr << "[TEST FAILED] " << modeName(mode) << " returned an inconsistent tour." << std::endl;
+            return -1;
+        }
+        std::cout << "  " << std::left << std::setw(10) << modeName(mode) << std::right << " : " << std::fixed
+                  << std::setprecision(2) << distance << " in " << elapsed << " s" << std::endl;
+    }
+    std::cout << "[Step 3] Mode Comparison: SUCCESS" << std::endl;
+
+    std::cout << "All selection mode tests passed!" << std::endl;
+    return 0;
+}
@@ -5,8 +5,10 @@
 #include <cmath>
 #include <iomanip>
 #include <map>
+#include <chrono>
 #include "Parser/TSPLIBParser.h"
 #include "Core/GASolver.h"
+#include "Core/ProblemInstance.h"
 #include "TestUtils.h"
 
 struct Stats {
@@ -28,7 +30,8 @@ void runBenchmark(const std::string& name, const std::string& path, double optim
     std::cout << "\n>>> Benchmarking Instance: " << name << " (Optimal: " << optimalDist << ")" << std::endl;
     
     auto cities = TSPLIBParser::parse(path);
-    
+    // 距離矩陣只建一次，所有回合共用同一份唯讀實例
+    auto instance = ProblemInstance::create(cities);
     
     GAConfig config;
     config.cityCount = cities.size();
@@ -49,7 +52,7 @@ void runBenchmark(const std::string& name, const std::string& path, double optim
     for (int i = 0; i < runs; ++i) {
         std::cout << "  > Progress: Run " << i + 1 << "/" << runs << " " << std::flush;
         
-        GASolver solver(config, cities);
+        GASolver solver(config, instance);
         
         auto start = std::chrono::high_resolution_clock::now();
         Individual res = solver.solve(); // solve 內部現在會觸發上面的 Lambda
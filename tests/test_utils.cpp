@@ -2,6 +2,7 @@
 #include <iostream>
 #include <cassert>
 #include <cmath>
+#include <chrono>
 
 int main() {
     std::cout << "--- Running Utils Test ---" << std::endl;
@@ -37,6 +38,53 @@ int main() {
     }
     std::cout << "[Step 3] Randomization: SUCCESS" << std::endl;
 
+    // 4. 群聚與格點產生器：數量、編號與邊界
+    auto clustered = Utils::generateClusteredCities(500, 8, 1000.0, 500.0);
+    auto grid = Utils::generateGridCities(10, 300.0, 300.0);
+    // Release 建構會定義 NDEBUG，以下改用明確檢查
+    bool generatorsOk = clustered.size() == 500 && grid.size() == 10;
+    for (int i = 0; generatorsOk && i < 500; ++i) {
+        generatorsOk = clustered[i].id == i && clustered[i].x >= 0 && clustered[i].x <= 1000.0 &&
+                       clustered[i].y >= 0 && clustered[i].y <= 500.0;
+    }
+    // 10 個城市 → 4 欄 3 列，格距 75 x 100
+    generatorsOk = generatorsOk && std::abs(grid[5].x - 1.5 * 75.0) < 1e-9 && std::abs(grid[5].y - 1.5 * 100.0) < 1e-9;
+    if (!generatorsOk) {
+        std::cerr << "[TEST FAILED] Clustered / grid generator output out of spec." << std::endl;
+        return -1;
+    }
+    std::cout << "[Step 4] Clustered & Grid Generators: SUCCESS" << std::endl;
+
+    // 5. 分磚平行建構：與逐項計算逐位元一致 (涵蓋不足一個磚塊的尾端)，並輸出建構時間對 n 的變化
+    for (int m : {1, 63, 65, 700}) {
+        auto pts = Utils::generateRandomCities(m, 1000.0, 1000.0);
+        for (unsigned int threads : {1u, 3u}) {
+            auto built = Utils::precomputeDistanceMatrix(pts, threads);
+            for (int i = 0; i < m; ++i) {
+                for (int j = 0; j < m; ++j) {
+                    double dx = pts[i].x - pts[j].x;
+                    double dy = pts[i].y - pts[j].y;
+                    if (built[static_cast<std::size_t>(i) * m + j] != std::sqrt(dx * dx + dy * dy)) {
+                        std::cerr << "[TEST FAILED] Tiled matrix mismatch at n = " << m << std::endl;
+                        return -1;
+                    }
+                }
+            }
+        }
+    }
+    for (int m : {1000, 2000, 5000}) {
+        auto pts = Utils::generateRandomCities(m, 1000.0, 1000.0);
+        std::cout << "  n = " << m << " :";
+        for (unsigned int threads : {1u, 0u}) {
+            auto start = std::chrono::high_resolution_clock::now();
+            auto built = Utils::precomputeDistanceMatrix(pts, threads);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+            std::cout << (threads == 1 ? " serial " : ", all threads ") << ms << " ms";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "[Step 5] Tiled Matrix Build: SUCCESS" << std::endl;
+
     std::cout << "All Utils tests passed!" << std::endl;
     return 0;
 }
\ No newline at end of file